@@ -16,7 +16,8 @@ Compile:
 Run:
     $ closest-pair
 */
-
+#include <cmath>
+#include <limits>
 
 /*
 Masalah:
@@ -39,21 +40,30 @@ double distance(point_t p1, point_t p2)
     return sqrt(x*x + y*y);
 }
 
+// kuadrat jarak, cukup untuk membandingkan jarak tanpa sqrt
+double distance2(point_t p1, point_t p2)
+{
+    double x = p1.x - p2.x;
+    double y = p1.y - p2.y;
+
+    return x*x + y*y;
+}
+
 // ======================================================================================
 
 void algorithm(point_t arr[], size_t size, size_t & idx1, size_t & idx2)
 {
-    double d, dmin = 0;
+    double d, dmin = std::numeric_limits<double>::infinity();
     size_t i, j;
 
     for (i = 0; i < size; i++)
     {
         for (j = i + 1; j < size; j++)
         {
-            // periksa jarak kedua titik dalam 2D
-            d = distance(arr[i], arr[j]);
+            // periksa jarak kedua titik dalam 2D (kuadrat jarak, tanpa sqrt)
+            d = distance2(arr[i], arr[j]);
 
-            if (d < dmin || dmin == 0)
+            if (d < dmin)
             {
                 dmin = d;
                 idx1 = i;
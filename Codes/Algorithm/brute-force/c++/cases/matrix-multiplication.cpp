@@ -16,6 +16,7 @@ Compile:
 Run:
     $ matrix-multiplication
 */
+#include <cstddef>
 
 // ======================================================================================
 
@@ -28,23 +29,29 @@ Run:
         M1 -> m x k
         M2 -> k x n
 
+    Matriks disimpan row-major dalam array 1 dimensi: elemen (i, j) dari matriks dengan
+    c kolom berada di index i * c + j.
+
+    M3[i][j] = M1[i][0] * M2[0][j] + M1[i][1] * M2[1][j] + ... + M1[i][k-1] * M2[k-1][j]
 */
 
 template <typename T>
-void algorithm(T M3 [][], T M1[][], T M2[][], size_t m, size_t n)
+void algorithm(T M3[], const T M1[], const T M2[], size_t m, size_t k, size_t n)
 {
-    size_t i, j, k;
+    size_t i, j, p;
 
     for (i = 0; i < m; i++)
     {
-        for (j = i; j < n; j++)
+        for (j = 0; j < n; j++)
         {
-            M3 [i][j] = 0;
+            T sum = T();
 
-            for (k = 0; k < n; k++)
+            for (p = 0; p < k; p++)
             {
-                M3 [i][j] = M3 [i][k] + M1 [i][k] * M2 [k][j];
+                sum = sum + M1[i * k + p] * M2[p * n + j];
             }
+
+            M3[i * n + j] = sum;
         }
     }
 }
\ No newline at end of file
@@ -16,22 +16,27 @@ Compile:
 Run:
     $ polynom-value
 */
-#include <cmath>
+#include <cstddef>
 
 
 /*
 Masalah:
     Diberikan sebuah senarai merepresentasikan koefisien polinom. Berapa nilai polinom jika
     variabel X disubstitusikan dengan suatu nilai?
+
+    coeff[i] adalah koefisien dari x^i. Tipe T menentukan rentang nilai: dengan int hasil
+    akan overflow untuk derajat / nilai x yang kecil sekalipun, gunakan int64_t, double,
+    atau tipe modular.
 */
 
 // ======================================================================================
 
-int algorithm(int coeff[], size_t size, int x)
+template <typename T>
+T algorithm(const T coeff[], size_t size, T x)
 {
-    size_t  i, j;
-    int     val = coeff[0];
-    int     pangkat = 1;
+    size_t  i;
+    T       val = coeff[0];
+    T       pangkat = 1;
 
     for (i = 1; i < size; i++)
     {
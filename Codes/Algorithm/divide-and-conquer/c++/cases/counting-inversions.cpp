@@ -5,18 +5,24 @@
     
 Compile:
     [clang]
-    $ clang++ counting-inversions.cpp -o counting-inversions
+    $ clang++ -std=c++14 -O2 -pthread counting-inversions.cpp -o counting-inversions
 
     [gcc]
-    $ g++ counting-inversions.cpp -o counting-inversions
+    $ g++ -std=c++14 -O2 -pthread counting-inversions.cpp -o counting-inversions
 
     [msvc]
-    $ cl counting-inversions.cpp
+    $ cl /std:c++14 /O2 counting-inversions.cpp
 
 Run:
     $ counting-inversions
 */
+#include <cmath>
+#include <vector>
+#include <thread>
 #include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
 
 /*
 Masalah:
@@ -29,15 +35,18 @@ Masalah:
 
 Contoh:
     baris 2, 4, 1, 3, 5 memiliki tiga inversion: (2, 1), (4, 1), (4, 3)
+
+    Jumlah inversion maksimum n(n - 1) / 2 sehingga dihitung dalam uint64_t; int sudah
+    overflow untuk array terbalik dengan n > 65536.
 */
 
 // ======================================================================================
 
 template <typename T>
-int merge(T arr[], T arr2[], size_t left, size_t mid, size_t right)
+uint64_t merge(T arr[], T arr2[], size_t left, size_t mid, size_t right)
 {
-    size_t i, j, k;
-    int    inv_count = 0;
+    size_t   i, j, k;
+    uint64_t inv_count = 0;
 
     i = k = left;
     j = mid;
@@ -70,9 +79,9 @@ int merge(T arr[], T arr2[], size_t left, size_t mid, size_t right)
 }
 
 template <typename T>
-int algorithm(T arr[], T arr2[], size_t left, size_t right)
+uint64_t algorithm(T arr[], T arr2[], size_t left, size_t right)
 {
-    int inv_count = 0;
+    uint64_t inv_count = 0;
     if (right > left)
     {
         /*
@@ -94,8 +103,396 @@ int algorithm(T arr[], T arr2[], size_t left, size_t right)
 }
 
 template <typename T>
-int algorithm(T arr[], size_t N)
+uint64_t algorithm(T arr[], size_t N)
+{
+    if (N == 0)
+        return 0;
+
+    // buffer di heap, array besar di stack (VLA) menyebabkan stack overflow
+    std::vector<T> arr2(N);
+    return algorithm(arr, arr2.data(), 0, N - 1);
+}
+
+// ======================================================================================
+
+/** Parallel Merge Sort **/
+
+/*
+    Versi di atas menyalin kembali hasil merge ke array awal pada setiap level dan hanya
+    memakai satu thread.
+
+    - Ping-pong buffer: a dan b berisi data yang sama. Kedua paruh diurutkan ke b (dengan
+      a sebagai buffer), lalu di-merge dari b ke a. Tidak ada salinan balik per level.
+    - Subarray kecil (<= 32 elemen) diurutkan dengan insertion sort; setiap pergeseran
+      elemen tepat satu inversion.
+    - Paruh kiri dikerjakan thread baru hingga kedalaman log2(jumlah thread).
+    - Merge pada level atas juga dibagi ke beberapa thread. Posisi awal setiap potongan
+      output dicari dengan binary search (co-rank) sehingga potongan saling bebas. Elemen
+      kanan yang diambil ketika indeks kiri = i tetap menyumbang (|L| - i) inversion
+      karena i adalah indeks global di L.
+*/
+
+// merge L[i .. i_end) dan R[j .. j_end) ke out; nl = |L| keseluruhan
+template <typename T>
+uint64_t merge_range(const T L[], size_t i, size_t i_end, size_t nl,
+    const T R[], size_t j, size_t j_end, T out[])
+{
+    uint64_t count = 0;
+
+    // tanpa percabangan: pada data acak hasil perbandingan tidak dapat ditebak CPU
+    while (i < i_end && j < j_end)
+    {
+        bool take_r = R[j] < L[i];
+
+        *out++ = take_r ? R[j] : L[i];
+        count += take_r ? nl - i : 0;
+        j += take_r;
+        i += ! take_r;
+    }
+
+    // sisa R tidak pernah terjadi bersamaan dengan sisa L
+    for (; j < j_end; j++)
+    {
+        count += nl - i;
+        *out++ = R[j];
+    }
+
+    while (i < i_end)
+        *out++ = L[i++];
+
+    return count;
+}
+
+// jumlah elemen L di antara k elemen pertama hasil merge (elemen L didahulukan bila sama)
+template <typename T>
+size_t co_rank(const T L[], size_t nl, const T R[], size_t nr, size_t k)
+{
+    size_t lo = (k > nr) ? k - nr : 0;
+    size_t hi = std::min(k, nl);
+
+    while (lo < hi)
+    {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+
+        // L[i] harus masuk bila L[i] <= R[j - 1]
+        if (j > 0 && L[i] <= R[j - 1])
+            lo = i + 1;
+        else
+            hi = i;
+    }
+
+    return lo;
+}
+
+template <typename T>
+uint64_t merge_parallel(const T L[], size_t nl, const T R[], size_t nr, T out[], size_t parts)
+{
+    if (parts <= 1)
+        return merge_range(L, 0, nl, nl, R, 0, nr, out);
+
+    size_t n = nl + nr;
+    std::vector<size_t>   cut(parts + 1);
+    std::vector<uint64_t> count(parts, 0);
+    std::vector<std::thread> workers;
+
+    for (size_t p = 0; p <= parts; p++)
+        cut[p] = co_rank(L, nl, R, nr, n * p / parts);
+
+    for (size_t p = 0; p < parts; p++)
+    {
+        workers.emplace_back([&, p] {
+            size_t k0 = n * p / parts, k1 = n * (p + 1) / parts;
+            count[p] = merge_range(L, cut[p], cut[p + 1], nl,
+                R, k0 - cut[p], k1 - cut[p + 1], out + k0);
+        });
+    }
+
+    for (auto & w : workers)
+        w.join();
+
+    uint64_t total = 0;
+    for (uint64_t c : count)
+        total += c;
+
+    return total;
+}
+
+template <typename T>
+uint64_t insertion_count(T a[], size_t n)
+{
+    uint64_t count = 0;
+
+    for (size_t i = 1; i < n; i++)
+    {
+        T      x = a[i];
+        size_t j = i;
+
+        for (; j > 0 && a[j - 1] > x; j--)
+            a[j] = a[j - 1];
+
+        a[j] = x;
+        count += i - j;
+    }
+
+    return count;
+}
+
+// a dan b berisi data yang sama; setelah selesai a terurut, b berisi sampah
+template <typename T>
+uint64_t sort_count(T a[], T b[], size_t n, int depth)
+{
+    if (n <= 32)
+        return insertion_count(a, n);
+
+    size_t   mid = n / 2;
+    uint64_t left = 0, right = 0;
+
+    if (depth > 0 && n >= (1 << 16))
+    {
+        std::thread worker([&] { left = sort_count(b, a, mid, depth - 1); });
+        right = sort_count(b + mid, a + mid, n - mid, depth - 1);
+        worker.join();
+
+        return left + right + merge_parallel(b, mid, b + mid, n - mid, a, size_t(1) << depth);
+    }
+
+    left  = sort_count(b, a, mid, 0);
+    right = sort_count(b + mid, a + mid, n - mid, 0);
+
+    return left + right + merge_range(b, 0, mid, mid, b + mid, 0, n - mid, a);
+}
+
+// arr tidak diubah
+template <typename T>
+uint64_t algorithm(const T arr[], size_t N, bool parallel)
+{
+    std::vector<T> a(arr, arr + N), b(arr, arr + N);
+
+    int depth = 0;
+    if (parallel)
+    {
+        unsigned nthreads = std::max(1u, std::thread::hardware_concurrency());
+        while ((1u << depth) < nthreads)
+            depth++;
+    }
+
+    return sort_count(a.data(), b.data(), N, depth);
+}
+
+// ======================================================================================
+
+/** Fenwick Tree **/
+
+/*
+    Alternatif tanpa merge: nilai dikompresi menjadi rank 1 .. d (d = jumlah nilai
+    berbeda), lalu array ditelusuri dari kiri. Fenwick tree menyimpan berapa kali setiap
+    rank sudah muncul; elemen ke-i membentuk inversion dengan setiap elemen sebelumnya
+    yang lebih besar:
+
+        inversion(i) = i - (jumlah elemen sebelumnya dengan rank <= rank(i))
+
+    Prefix sum dan update masing-masing O(log d). Akses Fenwick tree acak sehingga lebih
+    lambat dari merge sort untuk array besar, namun cocok bila nilai sudah berupa rank
+    kecil (d << N) atau sebagai dasar versi incremental dengan domain tetap.
+*/
+
+struct fenwick_t
+{
+    std::vector<uint32_t> tree;         // indeks 1 .. n
+
+    fenwick_t(size_t n) : tree(n + 1, 0) {}
+
+    void add(size_t i)
+    {
+        for (; i < tree.size(); i += i & (0 - i))
+            tree[i]++;
+    }
+
+    // jumlah pada indeks 1 .. i
+    uint64_t prefix(size_t i) const
+    {
+        uint64_t sum = 0;
+        for (; i > 0; i -= i & (0 - i))
+            sum += tree[i];
+        return sum;
+    }
+};
+
+// rank[i] di [1, d] dengan urutan yang sama seperti arr, nilai sama mendapat rank sama
+template <typename T>
+size_t compress(const T arr[], size_t N, std::vector<uint32_t> & rank)
+{
+    std::vector<std::pair<T, uint32_t>> sorted(N);
+
+    for (size_t i = 0; i < N; i++)
+        sorted[i] = std::make_pair(arr[i], (uint32_t) i);
+
+    std::sort(sorted.begin(), sorted.end());
+
+    rank.resize(N);
+    size_t d = 0;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        if (i == 0 || sorted[i - 1].first < sorted[i].first)
+            d++;
+        rank[sorted[i].second] = (uint32_t) d;
+    }
+
+    return d;
+}
+
+template <typename T>
+uint64_t fenwick(const T arr[], size_t N)
+{
+    std::vector<uint32_t> rank;
+    fenwick_t bit(compress(arr, N, rank));
+    uint64_t  count = 0;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        count += i - bit.prefix(rank[i]);
+        bit.add(rank[i]);
+    }
+
+    return count;
+}
+
+// ======================================================================================
+
+/** Incremental **/
+
+/*
+    Jumlah inversion diperbarui setiap kali elemen ditambahkan di akhir. Elemen baru x
+    membentuk inversion dengan setiap elemen sebelumnya yang lebih besar dari x.
+
+    Elemen disimpan sebagai beberapa run terurut dengan ukuran berbeda pangkat dua
+    (seperti bilangan biner / LSM tree): run[i] kosong atau berisi tepat 2^i elemen.
+    - query:  jumlah elemen > x = jumlah hasil binary search di setiap run, O(log^2 n)
+    - append: run berukuran 1 di-merge ke atas seperti carry pada penjumlahan biner,
+              amortized O(log n) per elemen
+    Tidak perlu mengetahui domain nilai di awal.
+*/
+
+template <typename T>
+struct inversion_counter_t
+{
+    uint64_t inversions = 0;
+    size_t   size = 0;
+
+    std::vector<std::vector<T>> run;
+
+    // jumlah elemen yang sudah ditambahkan dan lebih besar dari x
+    uint64_t greater(const T & x) const
+    {
+        uint64_t count = 0;
+
+        for (const auto & r : run)
+            count += r.end() - std::upper_bound(r.begin(), r.end(), x);
+
+        return count;
+    }
+
+    uint64_t append(const T & x)
+    {
+        inversions += greater(x);
+        size++;
+
+        std::vector<T> carry(1, x), merged;
+
+        for (size_t i = 0; ; i++)
+        {
+            if (i == run.size())
+                run.emplace_back();
+
+            if (run[i].empty())
+            {
+                run[i].swap(carry);
+                break;
+            }
+
+            merged.resize(run[i].size() + carry.size());
+            std::merge(run[i].begin(), run[i].end(), carry.begin(), carry.end(), merged.begin());
+
+            run[i].clear();
+            carry.swap(merged);
+        }
+
+        return inversions;
+    }
+};
+
+// ======================================================================================
+
+/** Kendall Tau **/
+
+/*
+    Ukuran kesesuaian dua ranking x dan y atas N objek yang sama, di [-1, 1]. Pasangan
+    (i, j) concordant bila x dan y mengurutkan i dan j dengan arah yang sama, discordant
+    bila berlawanan.
+
+    Algoritma Knight, O(N log N): urutkan objek berdasarkan (x, y), lalu pasangan
+    discordant = jumlah inversion pada y. Nilai sama (tie) ditangani dengan tau-b:
+
+        n0 = N(N - 1) / 2
+        n1 = pasangan dengan x sama, n2 = pasangan dengan y sama
+        n3 = pasangan dengan x dan y sama
+
+        tau_b = (n0 - n1 - n2 + n3 - 2 * discordant) / sqrt((n0 - n1) (n0 - n2))
+
+    Tanpa tie rumus ini sama dengan tau-a = 1 - 4 * discordant / (N(N - 1)).
+*/
+
+// jumlah pasangan dengan nilai sama pada data terurut
+template <typename It, typename Equal>
+uint64_t tied_pairs(It first, It last, Equal equal)
+{
+    uint64_t pairs = 0;
+
+    for (It i = first; i != last; )
+    {
+        It j = i;
+        while (j != last && equal(*i, *j))
+            ++j;
+
+        uint64_t t = j - i;
+        pairs += t * (t - 1) / 2;
+        i = j;
+    }
+
+    return pairs;
+}
+
+template <typename X, typename Y>
+double kendall_tau(const X x[], const Y y[], size_t N, bool parallel = true)
 {
-    T arr2[N];
-    return algorithm(arr, arr2, 0, N - 1);
+    std::vector<std::pair<X, Y>> obj(N);
+
+    for (size_t i = 0; i < N; i++)
+        obj[i] = std::make_pair(x[i], y[i]);
+
+    std::sort(obj.begin(), obj.end());
+
+    uint64_t n0 = (uint64_t) N * (N - 1) / 2;
+    uint64_t n1 = tied_pairs(obj.begin(), obj.end(),
+        [](const std::pair<X, Y> & a, const std::pair<X, Y> & b) { return a.first == b.first; });
+    uint64_t n3 = tied_pairs(obj.begin(), obj.end(),
+        [](const std::pair<X, Y> & a, const std::pair<X, Y> & b) { return a == b; });
+
+    // inversion y: pasangan dengan y sama tidak dihitung karena merge memakai <=
+    std::vector<Y> ys(N);
+    for (size_t i = 0; i < N; i++)
+        ys[i] = obj[i].second;
+
+    uint64_t discordant = algorithm(ys.data(), N, parallel);
+
+    std::sort(ys.begin(), ys.end());
+    uint64_t n2 = tied_pairs(ys.begin(), ys.end(),
+        [](const Y & a, const Y & b) { return a == b; });
+
+    double numerator   = (double) n0 - n1 - n2 + n3 - 2.0 * discordant;
+    double denominator = std::sqrt((double) (n0 - n1) * (double) (n0 - n2));
+
+    return (denominator > 0) ? numerator / denominator : 0;
 }
\ No newline at end of file
@@ -18,6 +18,10 @@ Compile:
 Run:
     $ fibonacci-sequence
 */
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
 
 /*
 Masalah:
@@ -57,13 +61,12 @@ void power(int F[2][2], int n)
     if (n == 0 || n == 1)
         return;
 
-    int i;
     int M[2][2] = {{1, 1}, {1, 0}};
 
     power(F, n/2);
     multiply(F, F);
 
-    if (n % 2 -- 1)
+    if (n % 2 == 1)
         multiply(F, M);
 }
 
@@ -82,4 +85,263 @@ int algorithm(int idx)
     power(F, idx - 1);
 
     return F[0][0];
+}
+
+// ======================================================================================
+
+/** Fast Doubling -- Big Integer **/
+
+/*
+    Matrix power di atas menggunakan int sehingga overflow untuk idx > 46.
+    Dari bentuk matrix dapat diturunkan identitas fast doubling:
+
+        F(2k)     = F(k) * (2 * F(k + 1) - F(k))
+        F(2k + 1) = F(k)^2 + F(k + 1)^2
+
+    Bit idx ditelusuri dari posisi tertinggi. Setiap langkah hanya membutuhkan 3 perkalian
+    (bukan 8 perkalian pada matrix 2x2) dan nilai disimpan sebagai bigint_t sehingga hasil
+    selalu eksak.
+*/
+
+/*
+    bigint_t beserta operasinya, sama seperti bagian Big Integer
+    (mathematic/c++/cases/numbers/big-integer.cpp)
+*/
+struct bigint_t
+{
+    std::vector<uint64_t> limb;
+
+    bigint_t(uint64_t value = 0)
+    {
+        if (value)
+            limb.push_back(value);
+    }
+
+    bool is_zero() const
+    {
+        return limb.empty();
+    }
+};
+
+// buang limb 0 di posisi tertinggi
+void normalize(bigint_t & a)
+{
+    while (! a.limb.empty() && a.limb.back() == 0)
+        a.limb.pop_back();
+}
+
+// a += b * B^offset (B = 2^64)
+void add_shifted(bigint_t & a, const bigint_t & b, size_t offset = 0)
+{
+    if (a.limb.size() < b.limb.size() + offset)
+        a.limb.resize(b.limb.size() + offset, 0);
+
+    uint64_t carry = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 s = (unsigned __int128) a.limb[i + offset] + b.limb[i] + carry;
+        a.limb[i + offset] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+    }
+
+    // rambatkan carry
+    for (i += offset; carry && i < a.limb.size(); i++)
+    {
+        a.limb[i] += carry;
+        carry = (a.limb[i] == 0);
+    }
+
+    if (carry)
+        a.limb.push_back(carry);
+}
+
+bigint_t add(const bigint_t & a, const bigint_t & b)
+{
+    bigint_t result = a;
+    add_shifted(result, b);
+    return result;
+}
+
+// a -= b, dengan syarat a >= b
+void sub_inplace(bigint_t & a, const bigint_t & b)
+{
+    uint64_t borrow = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 d = (unsigned __int128) a.limb[i] - b.limb[i] - borrow;
+        a.limb[i] = (uint64_t) d;
+        borrow = (uint64_t) (d >> 127);
+    }
+
+    for (; borrow && i < a.limb.size(); i++)
+    {
+        borrow = (a.limb[i] == 0);
+        a.limb[i] --;
+    }
+
+    normalize(a);
+}
+
+bigint_t sub(const bigint_t & a, const bigint_t & b)
+{
+    bigint_t result = a;
+    sub_inplace(result, b);
+    return result;
+}
+
+const size_t KARATSUBA_THRESHOLD = 32;
+
+// out[0 .. na + nb) = a * b, out harus bernilai 0 sebelumnya
+void mul_schoolbook(const uint64_t a[], size_t na, const uint64_t b[], size_t nb,
+    uint64_t out[])
+{
+    for (size_t i = 0; i < na; i++)
+    {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < nb; j++)
+        {
+            unsigned __int128 p = (unsigned __int128) a[i] * b[j] + out[i + j] + carry;
+            out[i + j] = (uint64_t) p;
+            carry = (uint64_t) (p >> 64);
+        }
+        out[i + nb] = carry;
+    }
+}
+
+// bentuk bigint_t dari potongan limb [low, high)
+bigint_t slice(const bigint_t & a, size_t low, size_t high)
+{
+    bigint_t result;
+
+    low  = std::min(low,  a.limb.size());
+    high = std::min(high, a.limb.size());
+    result.limb.assign(a.limb.begin() + low, a.limb.begin() + high);
+    normalize(result);
+
+    return result;
+}
+
+bigint_t mul(const bigint_t & a, const bigint_t & b)
+{
+    size_t na = a.limb.size(), nb = b.limb.size();
+    bigint_t result;
+
+    if (na == 0 || nb == 0)
+        return result;
+
+    // operand kecil: schoolbook
+    if (std::min(na, nb) < KARATSUBA_THRESHOLD)
+    {
+        result.limb.assign(na + nb, 0);
+        if (na >= nb)
+            mul_schoolbook(a.limb.data(), na, b.limb.data(), nb, result.limb.data());
+        else
+            mul_schoolbook(b.limb.data(), nb, a.limb.data(), na, result.limb.data());
+        normalize(result);
+        return result;
+    }
+
+    // operand tidak seimbang: potong operand panjang seukuran operand pendek
+    if (2 * std::min(na, nb) <= std::max(na, nb))
+    {
+        const bigint_t & lng = (na > nb) ? a : b;
+        const bigint_t & sht = (na > nb) ? b : a;
+        size_t step = sht.limb.size();
+
+        for (size_t i = 0; i < lng.limb.size(); i += step)
+            add_shifted(result, mul(slice(lng, i, i + step), sht), i);
+
+        normalize(result);
+        return result;
+    }
+
+    // karatsuba
+    size_t m = std::max(na, nb) / 2;
+
+    bigint_t a0 = slice(a, 0, m), a1 = slice(a, m, na);
+    bigint_t b0 = slice(b, 0, m), b1 = slice(b, m, nb);
+
+    bigint_t z0 = mul(a0, b0);
+    bigint_t z2 = mul(a1, b1);
+    bigint_t z1 = mul(add(a0, a1), add(b0, b1));
+    sub_inplace(z1, z0);
+    sub_inplace(z1, z2);
+
+    result = z0;
+    add_shifted(result, z1, m);
+    add_shifted(result, z2, 2 * m);
+    normalize(result);
+
+    return result;
+}
+
+bigint_t algorithm(uint64_t idx)
+{
+    bigint_t a(0);      // F(k)
+    bigint_t b(1);      // F(k + 1)
+
+    for (int bit = 63; bit >= 0; bit--)
+    {
+        // k -> 2k
+        bigint_t c = mul(a, sub(add(b, b), a));
+        bigint_t d = add(mul(a, a), mul(b, b));
+
+        // 2k -> 2k + 1
+        if ((idx >> bit) & 1)
+        {
+            a = d;
+            b = add(c, d);
+        }
+        else
+        {
+            a = c;
+            b = d;
+        }
+    }
+
+    return a;
+}
+
+// ======================================================================================
+
+/** Fast Doubling -- Modular **/
+
+/*
+    Identitas fast doubling yang sama dengan nilai modulo m (1 <= m < 2^63). Perkalian
+    dilakukan dalam 128-bit sehingga tidak overflow untuk m berapa pun.
+
+    Untuk relasi berorde k lain (tribonacci, climbing stairs dengan k langkah) atau
+    banyak idx sekaligus, lihat bagian Linear Recurrence (linear-recurrence.cpp).
+*/
+
+uint64_t algorithm(uint64_t idx, uint64_t mod)
+{
+    uint64_t a = 0;             // F(k)
+    uint64_t b = 1 % mod;       // F(k + 1)
+
+    for (int bit = 63; bit >= 0; bit--)
+    {
+        // k -> 2k
+        uint64_t twice = (b + b) % mod;
+        uint64_t c = (unsigned __int128) a * ((twice + mod - a) % mod) % mod;
+        uint64_t d = ((unsigned __int128) a * a + (unsigned __int128) b * b) % mod;
+
+        // 2k -> 2k + 1
+        if ((idx >> bit) & 1)
+        {
+            a = d;
+            b = (c + d) % mod;
+        }
+        else
+        {
+            a = c;
+            b = d;
+        }
+    }
+
+    return a;
 }
\ No newline at end of file
@@ -0,0 +1,361 @@
+/*
+    Linear Recurrence
+    Archive of Reversing.ID
+    Algorithm (Divide and Conquer)
+
+Compile:
+    [clang]
+    $ clang++ -std=c++14 -O2 -pthread linear-recurrence.cpp -o linear-recurrence
+
+    [gcc]
+    $ g++ -std=c++14 -O2 -pthread linear-recurrence.cpp -o linear-recurrence
+
+    [msvc]
+    $ cl /std:c++14 /O2 linear-recurrence.cpp
+
+Run:
+    $ linear-recurrence
+*/
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+/*
+Masalah:
+    Relasi rekursif linear berorde k dengan koefisien konstan:
+
+        a(n) = c[0] a(n - 1) + c[1] a(n - 2) + ... + c[k - 1] a(n - k)     (mod m)
+
+    dengan nilai awal a(0), ..., a(k - 1). Contoh:
+    - Fibonacci             k = 2, c = {1, 1},       a = {0, 1}
+    - Tribonacci            k = 3, c = {1, 1, 1},    a = {0, 0, 1}
+    - Climbing stairs       k langkah, c = {1, ..., 1}, a(0) = 1
+
+    Berapa nilai a(n) untuk n yang sangat besar (hingga 2^64)?
+
+Solusi:
+    1. Matrix power
+       Vektor state s(n) = (a(n), ..., a(n + k - 1)) dan s(n + 1) = M s(n) dengan M
+       companion matrix k x k. a(n) = (M^n s(0))[0]. Binary exponentiation: O(k^3 log n).
+
+    2. Kitamasa / Fiduccia
+       Polinom karakteristik P(x) = x^k - c[0] x^(k-1) - ... - c[k-1]. Karena M memenuhi
+       P(M) = 0, berlaku
+           x^n mod P(x) = r[0] + r[1] x + ... + r[k-1] x^(k-1)
+           a(n) = r[0] a(0) + r[1] a(1) + ... + r[k-1] a(k-1)
+       x^n mod P dihitung dengan binary exponentiation di ring polinom mod P: setiap
+       langkah satu perkalian polinom O(k^2) dan reduksi O(k^2). Total O(k^2 log n).
+
+    3. Batch
+       Banyak n dengan relasi yang sama. Tabel x^(d * 16^j) mod P untuk digit d di
+       [1, 15] dan posisi j di [0, 15] dibangun sekali, lalu setiap n hanya membutuhkan
+       satu perkalian per digit hexadesimal n yang tidak nol (maksimal 15, tanpa
+       pengkuadratan). Query dibagi ke beberapa thread; tabel hanya dibaca.
+
+    Perkalian mod m dilakukan di 128-bit. Jumlah hasil kali diakumulasi tanpa reduksi dan
+    baru direduksi bila mendekati batas 128-bit, sehingga operasi % (pembagian 128-bit)
+    hanya sekali per koefisien hasil untuk m < 2^63. Syarat: 1 <= m < 2^63.
+*/
+
+// ======================================================================================
+
+typedef unsigned __int128 uint128_t;
+
+// x mod m; pembagian 64-bit jauh lebih cepat dari 128-bit bila x muat di 64-bit
+static inline
+uint64_t reduce(uint128_t x, uint64_t mod)
+{
+    return (x >> 64) ? (uint64_t) (x % mod) : (uint64_t) x % mod;
+}
+
+// acc += a * b tanpa overflow; a, b < m < 2^63 sehingga a * b < 2^126
+static inline
+void accumulate(uint128_t & acc, uint64_t a, uint64_t b, uint64_t mod)
+{
+    acc += (uint128_t) a * b;
+    if (acc >> 127)
+        acc %= mod;
+}
+
+struct recurrence_t
+{
+    typedef std::vector<uint64_t> poly_t;
+    typedef std::vector<uint64_t> matrix_t;
+
+    size_t   k;
+    uint64_t mod;
+    poly_t   coef;          // c[0 .. k-1]
+    poly_t   init;          // a(0 .. k-1)
+
+    std::vector<poly_t> table;      // table[16 * j + d] = x^(d * 16^j) mod P
+
+    recurrence_t(const uint64_t c[], const uint64_t a[], size_t k_, uint64_t m)
+        : k(k_), mod(m), coef(c, c + k_), init(a, a + k_)
+    {
+        for (auto & v : coef) v %= mod;
+        for (auto & v : init) v %= mod;
+    }
+
+    // -----------------------------------------------------------------------------------
+
+    /** Matrix Power **/
+
+    // C = A * B, k x k row-major
+    matrix_t mat_mul(const matrix_t & A, const matrix_t & B) const
+    {
+        matrix_t C(k * k);
+
+        for (size_t i = 0; i < k; i++)
+            for (size_t j = 0; j < k; j++)
+            {
+                uint128_t acc = 0;
+                for (size_t p = 0; p < k; p++)
+                    accumulate(acc, A[i * k + p], B[p * k + j], mod);
+                C[i * k + j] = reduce(acc, mod);
+            }
+
+        return C;
+    }
+
+    uint64_t matrix_power(uint64_t n) const
+    {
+        if (n < k)
+            return init[n];
+
+        // companion matrix: baris i < k - 1 menggeser state, baris terakhir berisi c
+        matrix_t M(k * k, 0), R(k * k, 0);
+
+        for (size_t i = 0; i + 1 < k; i++)
+            M[i * k + i + 1] = 1;
+        for (size_t i = 0; i < k; i++)
+            M[(k - 1) * k + (k - 1 - i)] = coef[i];
+        for (size_t i = 0; i < k; i++)
+            R[i * k + i] = 1 % mod;
+
+        for (; n > 0; n >>= 1)
+        {
+            if (n & 1)
+                R = mat_mul(R, M);
+            M = mat_mul(M, M);
+        }
+
+        uint128_t acc = 0;
+        for (size_t j = 0; j < k; j++)
+            accumulate(acc, R[j], init[j], mod);
+
+        return reduce(acc, mod);
+    }
+
+    // -----------------------------------------------------------------------------------
+
+    /** Kitamasa **/
+
+    // a * b mod P, a dan b berderajat < k
+    poly_t mul_mod(const poly_t & a, const poly_t & b) const
+    {
+        std::vector<uint128_t> acc(2 * k - 1, 0);
+
+        for (size_t i = 0; i < k; i++)
+        {
+            if (a[i] == 0)
+                continue;
+            for (size_t j = 0; j < k; j++)
+                accumulate(acc[i + j], a[i], b[j], mod);
+        }
+
+        // x^i = c[0] x^(i-1) + ... + c[k-1] x^(i-k), dari derajat tertinggi
+        for (size_t i = 2 * k - 2; i >= k; i--)
+        {
+            uint64_t top = reduce(acc[i], mod);
+            if (top == 0)
+                continue;
+            for (size_t j = 0; j < k; j++)
+                accumulate(acc[i - 1 - j], top, coef[j], mod);
+        }
+
+        poly_t r(k);
+        for (size_t i = 0; i < k; i++)
+            r[i] = reduce(acc[i], mod);
+
+        return r;
+    }
+
+    // a * x mod P, O(k)
+    poly_t mul_x(const poly_t & a) const
+    {
+        poly_t r(k);
+        uint64_t top = a[k - 1];
+
+        for (size_t i = k - 1; i > 0; i--)
+            r[i] = a[i - 1];
+        r[0] = 0;
+
+        for (size_t j = 0; j < k; j++)
+            r[k - 1 - j] = reduce(r[k - 1 - j] + (uint128_t) top * coef[j], mod);
+
+        return r;
+    }
+
+    // a(n) = sum r[i] a(i)
+    uint64_t combine(const poly_t & r) const
+    {
+        uint128_t acc = 0;
+        for (size_t i = 0; i < k; i++)
+            accumulate(acc, r[i], init[i], mod);
+
+        return reduce(acc, mod);
+    }
+
+    // x^n mod P
+    poly_t power_x(uint64_t n) const
+    {
+        poly_t r(k, 0);
+        r[0] = 1 % mod;
+
+        // mulai dari bit tertinggi n, pengkuadratan 1 tidak berguna
+        int bit = 63;
+        while (bit > 0 && ! ((n >> bit) & 1))
+            bit--;
+
+        for (; bit >= 0; bit--)
+        {
+            r = mul_mod(r, r);
+            if ((n >> bit) & 1)
+                r = mul_x(r);
+        }
+
+        return r;
+    }
+
+    uint64_t kitamasa(uint64_t n) const
+    {
+        if (n < k)
+            return init[n];
+
+        return combine(power_x(n));
+    }
+
+    // -----------------------------------------------------------------------------------
+
+    /** Batch **/
+
+    void prepare()
+    {
+        if (! table.empty())
+            return;
+
+        table.assign(16 * 16, poly_t());
+
+        poly_t x(k, 0);
+        if (k == 1)
+            x[0] = coef[0];         // x mod (x - c0) = c0
+        else
+            x[1] = 1;
+
+        poly_t step = x;            // x^(16^j)
+        for (size_t j = 0; j < 16; j++)
+        {
+            table[16 * j + 1] = step;
+            for (size_t d = 2; d < 16; d++)
+                table[16 * j + d] = mul_mod(table[16 * j + d - 1], step);
+
+            step = mul_mod(table[16 * j + 15], step);
+        }
+    }
+
+    // tabel harus sudah dibangun dengan prepare()
+    uint64_t lookup(uint64_t n) const
+    {
+        if (n < k)
+            return init[n];
+
+        poly_t r;
+        for (size_t j = 0; j < 16; j++, n >>= 4)
+        {
+            size_t d = n & 15;
+            if (d == 0)
+                continue;
+
+            r = r.empty() ? table[16 * j + d] : mul_mod(r, table[16 * j + d]);
+        }
+
+        return combine(r);
+    }
+
+    // out[i] = a(ns[i])
+    void batch(const uint64_t ns[], uint64_t out[], size_t N, bool parallel = true)
+    {
+        prepare();
+
+        size_t nthreads = parallel ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+        nthreads = std::max<size_t>(1, std::min(nthreads, N / 64));
+
+        auto work = [this, ns, out](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++)
+                out[i] = lookup(ns[i]);
+        };
+
+        if (nthreads == 1)
+        {
+            work(0, N);
+            return;
+        }
+
+        size_t chunk = (N + nthreads - 1) / nthreads;
+        std::vector<std::thread> workers;
+
+        for (size_t lo = 0; lo < N; lo += chunk)
+            workers.emplace_back(work, lo, std::min(N, lo + chunk));
+
+        for (auto & w : workers)
+            w.join();
+    }
+
+    // -----------------------------------------------------------------------------------
+
+    // iterasi langsung O(nk) untuk n kecil, Kitamasa untuk n besar
+    uint64_t operator()(uint64_t n) const
+    {
+        if (n < k)
+            return init[n];
+
+        size_t bits = 0;
+        for (uint64_t t = n; t; t >>= 1)
+            bits++;
+
+        if (n > 2 * k * bits)
+            return kitamasa(n);
+
+        poly_t window(init);            // a(i - k .. i - 1), melingkar
+        uint64_t value = 0;
+
+        for (uint64_t i = k; i <= n; i++)
+        {
+            uint128_t acc = 0;
+            for (size_t j = 0; j < k; j++)
+                accumulate(acc, coef[j], window[(i - 1 - j) % k], mod);
+
+            value = reduce(acc, mod);
+            window[i % k] = value;
+        }
+
+        return value;
+    }
+};
+
+// ======================================================================================
+
+// a(n) dengan c[0 .. k-1] dan a(0 .. k-1), modulo m
+uint64_t algorithm(const uint64_t c[], const uint64_t a[], size_t k, uint64_t n, uint64_t mod)
+{
+    return recurrence_t(c, a, k, mod)(n);
+}
+
+// out[i] = a(ns[i]) dengan tabel pangkat yang sama
+void algorithm(const uint64_t c[], const uint64_t a[], size_t k, const uint64_t ns[],
+    uint64_t out[], size_t N, uint64_t mod)
+{
+    recurrence_t(c, a, k, mod).batch(ns, out, N);
+}
\ No newline at end of file
@@ -72,5 +72,101 @@ uint64_t algorithm(uint64_t base, uint64_t exp, uint64_t mod)
         base = (base * base) % mod;
     }
 
+    return result;
+}
+
+// ======================================================================================
+
+/**
+ * Montgomery Multiplication
+ * Non-Recursive
+ */
+
+/*
+    Solusi di atas menghitung (result * base) % mod dalam uint64_t sehingga overflow bila
+    mod > 2^32, dan setiap langkah membutuhkan instruksi pembagian.
+
+    Untuk mod ganjil (< 2^63) perkalian dilakukan di Montgomery form sehingga tidak ada
+    pembagian di dalam loop. Untuk mod genap, perkalian dilakukan dalam 128-bit.
+*/
+
+/*
+    montgomery_t beserta operasinya, sama seperti bagian Modular Arithmetic
+    (mathematic/c++/cases/numbers/modular-arithmetic.cpp)
+*/
+struct montgomery_t
+{
+    uint64_t mod;
+    uint64_t inv;       // m^-1 mod 2^64
+    uint64_t r2;        // 2^128 mod m
+
+    montgomery_t(uint64_t m) : mod(m)
+    {
+        // Newton iteration: setiap langkah menggandakan bit yang benar
+        inv = m;
+        for (int i = 0; i < 5; i++)
+            inv *= 2 - m * inv;
+
+        uint64_t r = (0 - m) % m;       // 2^64 mod m
+        r2 = (unsigned __int128) r * r % m;
+    }
+
+    uint64_t reduce(unsigned __int128 t) const
+    {
+        uint64_t q  = (uint64_t) t * inv;
+        uint64_t hi = (uint64_t) (t >> 64);
+        uint64_t qm = (uint64_t) (((unsigned __int128) q * mod) >> 64);
+
+        return (hi >= qm) ? hi - qm : hi - qm + mod;
+    }
+
+    uint64_t to_mont(uint64_t x) const      { return reduce((unsigned __int128) x * r2); }
+    uint64_t from_mont(uint64_t x) const    { return reduce(x); }
+
+    // a dan b dalam Montgomery form
+    uint64_t mul(uint64_t a, uint64_t b) const
+    {
+        return reduce((unsigned __int128) a * b);
+    }
+
+    // base dan hasil dalam bentuk biasa
+    uint64_t pow(uint64_t base, uint64_t exp) const
+    {
+        uint64_t result = to_mont(1);
+
+        base = to_mont(base % mod);
+        while (exp > 0)
+        {
+            if (exp & 1)
+                result = mul(result, base);
+
+            exp  >>= 1;
+            base = mul(base, base);
+        }
+
+        return from_mont(result);
+    }
+};
+
+uint64_t algorithm(uint64_t base, uint64_t exp, uint64_t mod)
+{
+    if (mod == 1)
+        return 0;
+
+    if ((mod & 1) && mod < (1ULL << 63))
+        return montgomery_t(mod).pow(base, exp);
+
+    uint64_t result = 1;
+
+    base = base % mod;
+    while (exp > 0)
+    {
+        if (exp & 1)
+            result = (unsigned __int128) result * base % mod;
+
+        exp  = exp / 2;
+        base = (unsigned __int128) base * base % mod;
+    }
+
     return result;
 }
\ No newline at end of file
@@ -16,6 +16,13 @@ Compile:
 Run:
     $ bell-numbers
 */
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 /*
     Bell numbers adalah barisan angka natural yang muncul di beberapa permasalahan
@@ -50,4 +57,208 @@ size_t algorithm(size_t N)
     }
 
     return table[N][0];
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- Bell Triangle with Row Reuse -- Big Integer **/
+
+/*
+    Tabulasi di atas menyimpan tabel (N + 1) x (N + 1) di stack dan overflow untuk n > 15.
+
+    Pada Bell triangle, setiap baris hanya bergantung pada baris sebelumnya:
+
+        row[i][0] = row[i - 1][i - 1]
+        row[i][j] = row[i][j - 1] + row[i - 1][j - 1]
+
+    sehingga cukup satu baris yang diperbarui di tempat (memori O(n) bigint_t).
+    Penjumlahan dilakukan in-place lalu ditukar dengan swap sehingga tidak ada alokasi
+    bigint_t baru di inner loop.
+*/
+
+/*
+    bigint_t beserta operasinya, sama seperti bagian Big Integer
+    (mathematic/c++/cases/numbers/big-integer.cpp)
+*/
+struct bigint_t
+{
+    std::vector<uint64_t> limb;
+
+    bigint_t(uint64_t value = 0)
+    {
+        if (value)
+            limb.push_back(value);
+    }
+
+    bool is_zero() const
+    {
+        return limb.empty();
+    }
+};
+
+// a += b * B^offset (B = 2^64)
+void add_shifted(bigint_t & a, const bigint_t & b, size_t offset = 0)
+{
+    if (a.limb.size() < b.limb.size() + offset)
+        a.limb.resize(b.limb.size() + offset, 0);
+
+    uint64_t carry = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 s = (unsigned __int128) a.limb[i + offset] + b.limb[i] + carry;
+        a.limb[i + offset] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+    }
+
+    // rambatkan carry
+    for (i += offset; carry && i < a.limb.size(); i++)
+    {
+        a.limb[i] += carry;
+        carry = (a.limb[i] == 0);
+    }
+
+    if (carry)
+        a.limb.push_back(carry);
+}
+
+bigint_t algorithm(size_t N)
+{
+    std::vector<bigint_t> row;
+    row.push_back(bigint_t(1));
+
+    for (size_t i = 1; i <= N; i++)
+    {
+        // carry menyimpan row[i][j], row[j] masih berisi row[i - 1][j]
+        bigint_t carry = row.back();
+
+        for (size_t j = 0; j < row.size(); j++)
+        {
+            add_shifted(row[j], carry);     // row[j] = row[i][j + 1]
+            std::swap(row[j], carry);       // row[j] = row[i][j]
+        }
+
+        row.push_back(std::move(carry));
+    }
+
+    return row[0];
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- Parallel Wavefront Tabulation **/
+
+/*
+    Bell triangle tidak memiliki dependensi lokal (row[i][0] = row[i - 1][i - 1]),
+    sehingga digunakan bentuk Stirling number of the second kind:
+
+        S(n, k) = k * S(n - 1, k) + S(n - 1, k - 1)
+        B(n)    = sum S(n, k) untuk 0 <= k <= n
+
+    Rekurens S hanya bergantung pada cell di atas dan kiri-atas sehingga dapat diserahkan
+    ke engine wavefront (paralel, memori O(N)). Nilai dihitung modulo mod.
+*/
+
+/*
+    wavefront() engine, sama seperti bagian Dynamic Programming
+    (dynamic-programming/c++/dynamic-programming-4.cpp)
+*/
+template <typename T, typename Cell>
+std::vector<T> wavefront(size_t rows, size_t cols, Cell cell, size_t tile = 512)
+{
+    size_t nbr = (rows + tile - 1) / tile;      // jumlah baris tile
+    size_t nbc = (cols + tile - 1) / tile;      // jumlah kolom tile
+
+    std::vector<T> top(cols, T());
+    std::vector<std::vector<T>> left(nbr, std::vector<T>(tile + 1, T()));
+
+    // proses satu tile dengan rolling row lokal
+    auto run_tile = [&](size_t bi, size_t bj)
+    {
+        size_t r0 = bi * tile, r1 = std::min(rows, r0 + tile);
+        size_t c0 = bj * tile, c1 = std::min(cols, c0 + tile);
+        size_t w  = c1 - c0;
+
+        // prev[0] adalah kolom di kiri tile, prev[1..w] baris di atas tile
+        std::vector<T> prev(w + 1), cur(w + 1);
+        std::vector<T> & lcol = left[bi];
+
+        prev[0] = (bj > 0) ? lcol[0] : T();
+        for (size_t j = 0; j < w; j++)
+            prev[j + 1] = top[c0 + j];
+
+        // corner untuk tile di kanan: nilai di atas kolom terakhir tile ini
+        T corner = prev[w];
+
+        for (size_t i = r0; i < r1; i++)
+        {
+            cur[0] = (bj > 0) ? lcol[i - r0 + 1] : T();
+
+            for (size_t j = 0; j < w; j++)
+                cur[j + 1] = cell(i, c0 + j, prev[j], prev[j + 1], cur[j]);
+
+            lcol[i - r0 + 1] = cur[w];
+            std::swap(prev, cur);
+        }
+
+        // publikasikan baris terakhir tile untuk tile di bawahnya
+        for (size_t j = 0; j < w; j++)
+            top[c0 + j] = prev[j + 1];
+        lcol[0] = corner;
+    };
+
+    size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // telusuri anti-diagonal tile
+    for (size_t d = 0; d + 1 < nbr + nbc; d++)
+    {
+        size_t bi_lo = (d >= nbc) ? d - nbc + 1 : 0;
+        size_t bi_hi = std::min(d, nbr - 1);
+        size_t count = bi_hi - bi_lo + 1;
+
+        // diagonal pendek dikerjakan langsung
+        if (count == 1 || nthreads == 1)
+        {
+            for (size_t bi = bi_lo; bi <= bi_hi; bi++)
+                run_tile(bi, d - bi);
+            continue;
+        }
+
+        std::atomic<size_t> next(bi_lo);
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0; t < std::min(nthreads, count); t++)
+        {
+            workers.emplace_back([&] {
+                size_t bi;
+                while ((bi = next++) <= bi_hi)
+                    run_tile(bi, d - bi);
+            });
+        }
+
+        for (auto & w : workers)
+            w.join();
+    }
+
+    return top;
+}
+
+uint64_t algorithm(size_t N, uint64_t mod)
+{
+    auto row = wavefront<uint64_t>(N + 1, N + 1,
+        [mod](size_t i, size_t j, uint64_t diag, uint64_t up, uint64_t /* left */) -> uint64_t {
+            if (i == 0)
+                return (j == 0) ? 1 % mod : 0;
+            if (j == 0)
+                return 0;
+
+            return ((unsigned __int128) j * up % mod + diag) % mod;
+        });
+
+    uint64_t result = 0;
+    for (auto s : row)
+        result = (result + s) % mod;
+
+    return result;
 }
\ No newline at end of file
@@ -17,6 +17,11 @@ Run:
     $ binomial-coefficient
 */
 #include <cstring>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <thread>
+#include <atomic>
 
 /*
     Binomial Coefficient didefinisikan sebagai:
@@ -85,4 +90,502 @@ int algorithm(size_t N, size_t K)
     }
 
     return table[K];
+}
+
+// ======================================================================================
+
+/** Prime Factorization -- Big Integer **/
+
+/*
+    Tabulasi di atas menggunakan int sehingga overflow untuk n > 33.
+
+    C(n, k) = n! / (k! * (n - k)!)
+
+    Pangkat bilangan prima p pada n! dihitung dengan Legendre's formula:
+
+        v(n!, p) = floor(n / p) + floor(n / p^2) + floor(n / p^3) + ...
+
+    sehingga pangkat p pada C(n, k) adalah v(n!, p) - v(k!, p) - v((n - k)!, p).
+    Hasil merupakan perkalian p^e untuk setiap bilangan prima p <= n. Faktor dikumpulkan
+    dalam word 64-bit lalu dikalikan dengan product tree agar perkalian bigint_t selalu
+    seimbang.
+*/
+
+/*
+    bigint_t beserta operasinya, sama seperti bagian Big Integer
+    (mathematic/c++/cases/numbers/big-integer.cpp)
+*/
+struct bigint_t
+{
+    std::vector<uint64_t> limb;
+
+    bigint_t(uint64_t value = 0)
+    {
+        if (value)
+            limb.push_back(value);
+    }
+
+    bool is_zero() const
+    {
+        return limb.empty();
+    }
+};
+
+// buang limb 0 di posisi tertinggi
+void normalize(bigint_t & a)
+{
+    while (! a.limb.empty() && a.limb.back() == 0)
+        a.limb.pop_back();
+}
+
+// a += b * B^offset (B = 2^64)
+void add_shifted(bigint_t & a, const bigint_t & b, size_t offset = 0)
+{
+    if (a.limb.size() < b.limb.size() + offset)
+        a.limb.resize(b.limb.size() + offset, 0);
+
+    uint64_t carry = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 s = (unsigned __int128) a.limb[i + offset] + b.limb[i] + carry;
+        a.limb[i + offset] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+    }
+
+    // rambatkan carry
+    for (i += offset; carry && i < a.limb.size(); i++)
+    {
+        a.limb[i] += carry;
+        carry = (a.limb[i] == 0);
+    }
+
+    if (carry)
+        a.limb.push_back(carry);
+}
+
+bigint_t add(const bigint_t & a, const bigint_t & b)
+{
+    bigint_t result = a;
+    add_shifted(result, b);
+    return result;
+}
+
+// a -= b, dengan syarat a >= b
+void sub_inplace(bigint_t & a, const bigint_t & b)
+{
+    uint64_t borrow = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 d = (unsigned __int128) a.limb[i] - b.limb[i] - borrow;
+        a.limb[i] = (uint64_t) d;
+        borrow = (uint64_t) (d >> 127);
+    }
+
+    for (; borrow && i < a.limb.size(); i++)
+    {
+        borrow = (a.limb[i] == 0);
+        a.limb[i] --;
+    }
+
+    normalize(a);
+}
+
+bigint_t sub(const bigint_t & a, const bigint_t & b)
+{
+    bigint_t result = a;
+    sub_inplace(result, b);
+    return result;
+}
+
+const size_t KARATSUBA_THRESHOLD = 32;
+
+// out[0 .. na + nb) = a * b, out harus bernilai 0 sebelumnya
+void mul_schoolbook(const uint64_t a[], size_t na, const uint64_t b[], size_t nb,
+    uint64_t out[])
+{
+    for (size_t i = 0; i < na; i++)
+    {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < nb; j++)
+        {
+            unsigned __int128 p = (unsigned __int128) a[i] * b[j] + out[i + j] + carry;
+            out[i + j] = (uint64_t) p;
+            carry = (uint64_t) (p >> 64);
+        }
+        out[i + nb] = carry;
+    }
+}
+
+// bentuk bigint_t dari potongan limb [low, high)
+bigint_t slice(const bigint_t & a, size_t low, size_t high)
+{
+    bigint_t result;
+
+    low  = std::min(low,  a.limb.size());
+    high = std::min(high, a.limb.size());
+    result.limb.assign(a.limb.begin() + low, a.limb.begin() + high);
+    normalize(result);
+
+    return result;
+}
+
+bigint_t mul(const bigint_t & a, const bigint_t & b)
+{
+    size_t na = a.limb.size(), nb = b.limb.size();
+    bigint_t result;
+
+    if (na == 0 || nb == 0)
+        return result;
+
+    // operand kecil: schoolbook
+    if (std::min(na, nb) < KARATSUBA_THRESHOLD)
+    {
+        result.limb.assign(na + nb, 0);
+        if (na >= nb)
+            mul_schoolbook(a.limb.data(), na, b.limb.data(), nb, result.limb.data());
+        else
+            mul_schoolbook(b.limb.data(), nb, a.limb.data(), na, result.limb.data());
+        normalize(result);
+        return result;
+    }
+
+    // operand tidak seimbang: potong operand panjang seukuran operand pendek
+    if (2 * std::min(na, nb) <= std::max(na, nb))
+    {
+        const bigint_t & lng = (na > nb) ? a : b;
+        const bigint_t & sht = (na > nb) ? b : a;
+        size_t step = sht.limb.size();
+
+        for (size_t i = 0; i < lng.limb.size(); i += step)
+            add_shifted(result, mul(slice(lng, i, i + step), sht), i);
+
+        normalize(result);
+        return result;
+    }
+
+    // karatsuba
+    size_t m = std::max(na, nb) / 2;
+
+    bigint_t a0 = slice(a, 0, m), a1 = slice(a, m, na);
+    bigint_t b0 = slice(b, 0, m), b1 = slice(b, m, nb);
+
+    bigint_t z0 = mul(a0, b0);
+    bigint_t z2 = mul(a1, b1);
+    bigint_t z1 = mul(add(a0, a1), add(b0, b1));
+    sub_inplace(z1, z0);
+    sub_inplace(z1, z2);
+
+    result = z0;
+    add_shifted(result, z1, m);
+    add_shifted(result, z2, 2 * m);
+    normalize(result);
+
+    return result;
+}
+
+void mul_small(bigint_t & a, uint64_t m)
+{
+    if (m == 0)
+    {
+        a.limb.clear();
+        return;
+    }
+
+    uint64_t carry = 0;
+    for (auto & x : a.limb)
+    {
+        unsigned __int128 p = (unsigned __int128) x * m + carry;
+        x = (uint64_t) p;
+        carry = (uint64_t) (p >> 64);
+    }
+
+    if (carry)
+        a.limb.push_back(carry);
+}
+
+bigint_t product(const std::vector<uint64_t> & arr, size_t low, size_t high)
+{
+    if (high - low <= 16)
+    {
+        bigint_t result(1);
+        for (size_t i = low; i < high; i++)
+            mul_small(result, arr[i]);
+        return result;
+    }
+
+    size_t mid = low + (high - low) / 2;
+    return mul(product(arr, low, mid), product(arr, mid, high));
+}
+
+// bangkitkan bilangan prima <= N. Lihat di bagian Sieve of Eratosthenes
+std::vector<size_t> sieve(size_t N);
+
+// pangkat bilangan prima p pada N!
+size_t legendre(size_t N, size_t p)
+{
+    size_t e = 0;
+
+    while (N)
+    {
+        N /= p;
+        e += N;
+    }
+
+    return e;
+}
+
+bigint_t algorithm(size_t N, size_t K)
+{
+    std::vector<uint64_t> factors;
+    uint64_t word = 1;
+
+    if (K > N)
+        return bigint_t(0);
+
+    for (size_t p : sieve(N))
+    {
+        size_t e = legendre(N, p) - legendre(K, p) - legendre(N - K, p);
+
+        // gabungkan faktor selama masih muat dalam 64-bit
+        while (e--)
+        {
+            if (word > UINT64_MAX / p)
+            {
+                factors.push_back(word);
+                word = 1;
+            }
+            word *= p;
+        }
+    }
+
+    factors.push_back(word);
+    return product(factors, 0, factors.size());
+}
+
+// ======================================================================================
+
+/** Modular Arithmetic -- Precomputed Factorial **/
+
+/*
+    Banyak query C(n, k) mod p dengan p prima dan n < p.
+
+    C(n, k) = n! * (k!)^-1 * ((n - k)!)^-1  (mod p)
+
+    Faktorial dan invers faktorial dihitung sekali dalam O(N). Invers faktorial hanya
+    membutuhkan satu operasi invers:
+
+        (i - 1)!^-1 = i!^-1 * i
+
+    Setelah itu setiap query hanya membutuhkan dua perkalian, O(1).
+*/
+
+/*
+    modint_t beserta operasinya, sama seperti bagian Modular Arithmetic
+    (mathematic/c++/cases/numbers/modular-arithmetic.cpp)
+*/
+template <uint32_t M>
+struct modint_t
+{
+    uint32_t v;
+
+    constexpr modint_t(uint64_t x = 0) : v(x % M) {}
+
+    // bentuk dari nilai yang dipastikan sudah < M
+    static constexpr modint_t raw(uint32_t x)
+    {
+        modint_t r;
+        r.v = x;
+        return r;
+    }
+
+    constexpr modint_t operator+(modint_t b) const
+    {
+        uint32_t s = v + b.v;
+        return raw(s >= M ? s - M : s);
+    }
+
+    constexpr modint_t operator-(modint_t b) const
+    {
+        return raw(v >= b.v ? v - b.v : v + M - b.v);
+    }
+
+    constexpr modint_t operator*(modint_t b) const
+    {
+        return raw((uint64_t) v * b.v % M);
+    }
+
+    constexpr modint_t & operator+=(modint_t b) { return *this = *this + b; }
+    constexpr modint_t & operator-=(modint_t b) { return *this = *this - b; }
+    constexpr modint_t & operator*=(modint_t b) { return *this = *this * b; }
+
+    constexpr bool operator==(modint_t b) const { return v == b.v; }
+
+    // perpangkatan dengan binary exponentiation
+    constexpr modint_t pow(uint64_t exp) const
+    {
+        modint_t result(1), base = *this;
+
+        while (exp > 0)
+        {
+            if (exp & 1)
+                result *= base;
+
+            exp  >>= 1;
+            base *= base;
+        }
+
+        return result;
+    }
+
+    // invers dengan Fermat's little theorem, hanya berlaku bila M prima
+    constexpr modint_t inv() const
+    {
+        return pow(M - 2);
+    }
+};
+
+template <uint32_t M>
+struct factorial_table_t
+{
+    std::vector<modint_t<M>> fact;
+    std::vector<modint_t<M>> inv_fact;
+
+    factorial_table_t(size_t N) : fact(N + 1), inv_fact(N + 1)
+    {
+        fact[0] = 1;
+        for (size_t i = 1; i <= N; i++)
+            fact[i] = fact[i - 1] * i;
+
+        inv_fact[N] = fact[N].inv();
+        for (size_t i = N; i > 0; i--)
+            inv_fact[i - 1] = inv_fact[i] * i;
+    }
+};
+
+template <uint32_t M>
+modint_t<M> algorithm(const factorial_table_t<M> & table, size_t N, size_t K)
+{
+    if (K > N)
+        return 0;
+
+    return table.fact[N] * table.inv_fact[K] * table.inv_fact[N - K];
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- Parallel Wavefront Tabulation **/
+
+/*
+    Tabulasi di atas mengisi tabel (N + 1) x (K + 1) baris per baris dengan satu thread.
+    Rekurens hanya bergantung pada cell di atas dan kiri-atas sehingga dapat diserahkan
+    ke engine wavefront: tile pada anti-diagonal yang sama dikerjakan paralel dan hanya
+    baris yang masih dibutuhkan yang disimpan (memori O(N + K)).
+
+    Nilai dihitung modulo mod agar N, K dalam rentang 1e5 tidak overflow.
+*/
+
+/*
+    wavefront() engine, sama seperti bagian Dynamic Programming
+    (dynamic-programming/c++/dynamic-programming-4.cpp)
+*/
+template <typename T, typename Cell>
+std::vector<T> wavefront(size_t rows, size_t cols, Cell cell, size_t tile = 512)
+{
+    size_t nbr = (rows + tile - 1) / tile;      // jumlah baris tile
+    size_t nbc = (cols + tile - 1) / tile;      // jumlah kolom tile
+
+    std::vector<T> top(cols, T());
+    std::vector<std::vector<T>> left(nbr, std::vector<T>(tile + 1, T()));
+
+    // proses satu tile dengan rolling row lokal
+    auto run_tile = [&](size_t bi, size_t bj)
+    {
+        size_t r0 = bi * tile, r1 = std::min(rows, r0 + tile);
+        size_t c0 = bj * tile, c1 = std::min(cols, c0 + tile);
+        size_t w  = c1 - c0;
+
+        // prev[0] adalah kolom di kiri tile, prev[1..w] baris di atas tile
+        std::vector<T> prev(w + 1), cur(w + 1);
+        std::vector<T> & lcol = left[bi];
+
+        prev[0] = (bj > 0) ? lcol[0] : T();
+        for (size_t j = 0; j < w; j++)
+            prev[j + 1] = top[c0 + j];
+
+        // corner untuk tile di kanan: nilai di atas kolom terakhir tile ini
+        T corner = prev[w];
+
+        for (size_t i = r0; i < r1; i++)
+        {
+            cur[0] = (bj > 0) ? lcol[i - r0 + 1] : T();
+
+            for (size_t j = 0; j < w; j++)
+                cur[j + 1] = cell(i, c0 + j, prev[j], prev[j + 1], cur[j]);
+
+            lcol[i - r0 + 1] = cur[w];
+            std::swap(prev, cur);
+        }
+
+        // publikasikan baris terakhir tile untuk tile di bawahnya
+        for (size_t j = 0; j < w; j++)
+            top[c0 + j] = prev[j + 1];
+        lcol[0] = corner;
+    };
+
+    size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // telusuri anti-diagonal tile
+    for (size_t d = 0; d + 1 < nbr + nbc; d++)
+    {
+        size_t bi_lo = (d >= nbc) ? d - nbc + 1 : 0;
+        size_t bi_hi = std::min(d, nbr - 1);
+        size_t count = bi_hi - bi_lo + 1;
+
+        // diagonal pendek dikerjakan langsung
+        if (count == 1 || nthreads == 1)
+        {
+            for (size_t bi = bi_lo; bi <= bi_hi; bi++)
+                run_tile(bi, d - bi);
+            continue;
+        }
+
+        std::atomic<size_t> next(bi_lo);
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0; t < std::min(nthreads, count); t++)
+        {
+            workers.emplace_back([&] {
+                size_t bi;
+                while ((bi = next++) <= bi_hi)
+                    run_tile(bi, d - bi);
+            });
+        }
+
+        for (auto & w : workers)
+            w.join();
+    }
+
+    return top;
+}
+
+uint64_t algorithm(size_t N, size_t K, uint64_t mod)
+{
+    auto row = wavefront<uint64_t>(N + 1, K + 1,
+        [mod](size_t i, size_t j, uint64_t diag, uint64_t up, uint64_t /* left */) -> uint64_t {
+            if (j == 0)
+                return 1 % mod;
+            if (i == 0)
+                return 0;
+
+            // C(i, j) = C(i - 1, j - 1) + C(i - 1, j)
+            // penjumlahan 128-bit, diag + up dapat melewati 2^64 bila mod > 2^63
+            unsigned __int128 v = (unsigned __int128) diag + up;
+            return (uint64_t) ((v >= mod) ? v - mod : v);
+        });
+
+    return row[K];
 }
\ No newline at end of file
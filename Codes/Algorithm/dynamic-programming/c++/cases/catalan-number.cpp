@@ -16,6 +16,12 @@ Compile:
 Run:
     $ catalan-number
 */
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <functional>
 
 /*
     Catalan numbers adalah barisan angka natural yang muncul di beberapa permasalahan
@@ -86,4 +92,184 @@ size_t algorithm(size_t N)
     }
 
     return table[N];
+}
+
+// ======================================================================================
+
+/** Closed Form -- Big Integer **/
+
+/*
+    Tabulasi di atas menggunakan int sehingga overflow untuk n > 19, dan membutuhkan
+    O(n^2) operasi. Catalan number memiliki bentuk tertutup:
+
+        C(n) = C(2n, n) / (n + 1)
+
+    C(2n, n) dihitung secara eksak dengan faktorisasi prima, lalu dibagi (n + 1) yang
+    selalu habis membagi.
+*/
+
+/*
+    bigint_t beserta operasinya, sama seperti bagian Big Integer
+    (mathematic/c++/cases/numbers/big-integer.cpp)
+*/
+struct bigint_t
+{
+    std::vector<uint64_t> limb;
+
+    bigint_t(uint64_t value = 0)
+    {
+        if (value)
+            limb.push_back(value);
+    }
+
+    bool is_zero() const
+    {
+        return limb.empty();
+    }
+};
+
+// buang limb 0 di posisi tertinggi
+void normalize(bigint_t & a)
+{
+    while (! a.limb.empty() && a.limb.back() == 0)
+        a.limb.pop_back();
+}
+
+// a /= d, mengembalikan sisa bagi
+uint64_t div_small(bigint_t & a, uint64_t d)
+{
+    unsigned __int128 rem = 0;
+
+    for (size_t i = a.limb.size(); i-- > 0; )
+    {
+        unsigned __int128 cur = (rem << 64) | a.limb[i];
+        a.limb[i] = (uint64_t) (cur / d);
+        rem = cur % d;
+    }
+
+    normalize(a);
+    return (uint64_t) rem;
+}
+
+// binomial coefficient eksak. Lihat di bagian Binomial Coefficient (Prime Factorization)
+bigint_t binomial(size_t N, size_t K);
+
+bigint_t algorithm(size_t N)
+{
+    bigint_t result = binomial(2 * N, N);
+    div_small(result, N + 1);
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Recursive Solution -- Generic Memoization **/
+
+/*
+    Solusi memoization di atas dengan lookup table lokal ditulis ulang menggunakan
+    memoize_t. Lookup table (dense_table_t) dialokasikan di heap.
+*/
+
+/*
+    memoize_t dan dense_table_t, sama seperti bagian Dynamic Programming
+    (dynamic-programming/c++/dynamic-programming-3.cpp)
+*/
+struct memo_stats_t
+{
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> compute_ns{0};     // total waktu komputasi saat miss
+
+    double hit_rate() const
+    {
+        uint64_t total = hits + misses;
+        return total ? (double) hits / total : 0.0;
+    }
+
+    // rata-rata latency komputasi per miss (nanodetik), termasuk sub-pemanggilan
+    double miss_latency() const
+    {
+        return misses ? (double) compute_ns / misses : 0.0;
+    }
+};
+
+template <typename Key, typename Value, typename Table>
+struct memoize_t
+{
+    typedef std::function<Value(memoize_t &, const Key &)> function_t;
+
+    function_t   fn;
+    Table        table;
+    memo_stats_t stats;
+
+    template <typename... Args>
+    memoize_t(function_t fn, Args &&... args)
+        : fn(std::move(fn)), table(std::forward<Args>(args)...) {}
+
+    Value operator()(const Key & key)
+    {
+        // evaluasi apakah nilai pada subproblem telah dicatat
+        if (Value * v = table.find(key))
+        {
+            stats.hits.fetch_add(1, std::memory_order_relaxed);
+            return *v;
+        }
+
+        stats.misses.fetch_add(1, std::memory_order_relaxed);
+
+        // komputasi dan simpan hasil ke dalam tabel
+        auto  start  = std::chrono::steady_clock::now();
+        Value result = fn(*this, key);
+        auto  elapsed = std::chrono::steady_clock::now() - start;
+
+        stats.compute_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+            std::memory_order_relaxed);
+
+        table.insert(key, result);
+        return result;
+    }
+};
+
+// dense_table_t tanpa snapshot ke disk (save/load)
+template <typename Value>
+struct dense_table_t
+{
+    std::vector<Value>   values;
+    std::vector<uint8_t> present;
+
+    explicit dense_table_t(size_t N = 0) : values(N), present(N, 0) {}
+
+    Value * find(size_t key)
+    {
+        return (key < values.size() && present[key]) ? &values[key] : nullptr;
+    }
+
+    void insert(size_t key, const Value & value)
+    {
+        if (key >= values.size())
+            return;
+
+        values[key]  = value;
+        present[key] = 1;
+    }
+};
+
+size_t algorithm(size_t N)
+{
+    memoize_t<size_t, size_t, dense_table_t<size_t>> memo(
+        [](auto & self, size_t n) -> size_t {
+            if (n < 2)
+                return 1;
+
+            size_t result = 0;
+            for (size_t i = 0; i < n; i++)
+                result += self(i) * self(n - i - 1);
+
+            return result;
+        },
+        N + 1);
+
+    return memo(N);
 }
\ No newline at end of file
@@ -16,7 +16,12 @@ Compile:
 Run:
     $ distinct-way-to-climb-stair
 */
+#include <vector>
+#include <cstdint>
 #include <cstring>
+#include <atomic>
+#include <chrono>
+#include <functional>
 
 /*
 Masalah:
@@ -87,4 +92,300 @@ size_t algorithm(size_t N)
         table[i] = table[i - 1] + table[i - 2];
     
     return table[N];
+}
+
+// ======================================================================================
+
+/** Recursive Solution -- Generic Memoization **/
+
+/*
+    Solusi memoization di atas ditulis ulang menggunakan memoize_t. Lookup table
+    (dense_table_t) dialokasikan di heap.
+*/
+
+/*
+    memoize_t dan dense_table_t, sama seperti bagian Dynamic Programming
+    (dynamic-programming/c++/dynamic-programming-3.cpp)
+*/
+struct memo_stats_t
+{
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> compute_ns{0};     // total waktu komputasi saat miss
+
+    double hit_rate() const
+    {
+        uint64_t total = hits + misses;
+        return total ? (double) hits / total : 0.0;
+    }
+
+    // rata-rata latency komputasi per miss (nanodetik), termasuk sub-pemanggilan
+    double miss_latency() const
+    {
+        return misses ? (double) compute_ns / misses : 0.0;
+    }
+};
+
+template <typename Key, typename Value, typename Table>
+struct memoize_t
+{
+    typedef std::function<Value(memoize_t &, const Key &)> function_t;
+
+    function_t   fn;
+    Table        table;
+    memo_stats_t stats;
+
+    template <typename... Args>
+    memoize_t(function_t fn, Args &&... args)
+        : fn(std::move(fn)), table(std::forward<Args>(args)...) {}
+
+    Value operator()(const Key & key)
+    {
+        // evaluasi apakah nilai pada subproblem telah dicatat
+        if (Value * v = table.find(key))
+        {
+            stats.hits.fetch_add(1, std::memory_order_relaxed);
+            return *v;
+        }
+
+        stats.misses.fetch_add(1, std::memory_order_relaxed);
+
+        // komputasi dan simpan hasil ke dalam tabel
+        auto  start  = std::chrono::steady_clock::now();
+        Value result = fn(*this, key);
+        auto  elapsed = std::chrono::steady_clock::now() - start;
+
+        stats.compute_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+            std::memory_order_relaxed);
+
+        table.insert(key, result);
+        return result;
+    }
+};
+
+// dense_table_t tanpa snapshot ke disk (save/load)
+template <typename Value>
+struct dense_table_t
+{
+    std::vector<Value>   values;
+    std::vector<uint8_t> present;
+
+    explicit dense_table_t(size_t N = 0) : values(N), present(N, 0) {}
+
+    Value * find(size_t key)
+    {
+        return (key < values.size() && present[key]) ? &values[key] : nullptr;
+    }
+
+    void insert(size_t key, const Value & value)
+    {
+        if (key >= values.size())
+            return;
+
+        values[key]  = value;
+        present[key] = 1;
+    }
+};
+
+size_t algorithm(size_t N)
+{
+    memoize_t<size_t, size_t, dense_table_t<size_t>> memo(
+        [](auto & self, size_t n) -> size_t {
+            // cara yang digunakan untuk melewati 0, 1, dan 2 anak tangga
+            if (n <= 2)
+                return n;
+
+            return self(n - 1) + self(n - 2);
+        },
+        N + 1);
+
+    return memo(N);
+}
+
+// ======================================================================================
+
+/** K Steps -- Linear Recurrence **/
+
+/*
+    Bila setiap langkah dapat melewati 1 hingga K anak tangga, jumlah cara memenuhi
+
+        ways(n) = ways(n - 1) + ways(n - 2) + ... + ways(n - K),    ways(0) = 1
+
+    dengan ways(negatif) = 0. Ini relasi rekursif linear berorde K sehingga ways(N) mod m
+    dapat dihitung dalam O(K^2 log N) tanpa tabel sepanjang N.
+
+    K = 0 bukan relasi rekursif: tanpa langkah hanya N = 0 yang dapat dicapai.
+*/
+
+/*
+    recurrence_t (Kitamasa) beserta operasinya, sama seperti bagian Linear Recurrence
+    (divide-and-conquer/c++/cases/linear-recurrence.cpp), tanpa Matrix Power dan Batch.
+    Syarat: 1 <= m < 2^63.
+*/
+typedef unsigned __int128 uint128_t;
+
+// x mod m; pembagian 64-bit jauh lebih cepat dari 128-bit bila x muat di 64-bit
+static inline
+uint64_t reduce(uint128_t x, uint64_t mod)
+{
+    return (x >> 64) ? (uint64_t) (x % mod) : (uint64_t) x % mod;
+}
+
+// acc += a * b tanpa overflow; a, b < m < 2^63 sehingga a * b < 2^126
+static inline
+void accumulate(uint128_t & acc, uint64_t a, uint64_t b, uint64_t mod)
+{
+    acc += (uint128_t) a * b;
+    if (acc >> 127)
+        acc %= mod;
+}
+
+struct recurrence_t
+{
+    typedef std::vector<uint64_t> poly_t;
+
+    size_t   k;
+    uint64_t mod;
+    poly_t   coef;          // c[0 .. k-1]
+    poly_t   init;          // a(0 .. k-1)
+
+    recurrence_t(const uint64_t c[], const uint64_t a[], size_t k_, uint64_t m)
+        : k(k_), mod(m), coef(c, c + k_), init(a, a + k_)
+    {
+        for (auto & v : coef) v %= mod;
+        for (auto & v : init) v %= mod;
+    }
+
+    // a * b mod P, a dan b berderajat < k
+    poly_t mul_mod(const poly_t & a, const poly_t & b) const
+    {
+        std::vector<uint128_t> acc(2 * k - 1, 0);
+
+        for (size_t i = 0; i < k; i++)
+        {
+            if (a[i] == 0)
+                continue;
+            for (size_t j = 0; j < k; j++)
+                accumulate(acc[i + j], a[i], b[j], mod);
+        }
+
+        // x^i = c[0] x^(i-1) + ... + c[k-1] x^(i-k), dari derajat tertinggi
+        for (size_t i = 2 * k - 2; i >= k; i--)
+        {
+            uint64_t top = reduce(acc[i], mod);
+            if (top == 0)
+                continue;
+            for (size_t j = 0; j < k; j++)
+                accumulate(acc[i - 1 - j], top, coef[j], mod);
+        }
+
+        poly_t r(k);
+        for (size_t i = 0; i < k; i++)
+            r[i] = reduce(acc[i], mod);
+
+        return r;
+    }
+
+    // a * x mod P, O(k)
+    poly_t mul_x(const poly_t & a) const
+    {
+        poly_t r(k);
+        uint64_t top = a[k - 1];
+
+        for (size_t i = k - 1; i > 0; i--)
+            r[i] = a[i - 1];
+        r[0] = 0;
+
+        for (size_t j = 0; j < k; j++)
+            r[k - 1 - j] = reduce(r[k - 1 - j] + (uint128_t) top * coef[j], mod);
+
+        return r;
+    }
+
+    // a(n) = sum r[i] a(i)
+    uint64_t combine(const poly_t & r) const
+    {
+        uint128_t acc = 0;
+        for (size_t i = 0; i < k; i++)
+            accumulate(acc, r[i], init[i], mod);
+
+        return reduce(acc, mod);
+    }
+
+    // x^n mod P
+    poly_t power_x(uint64_t n) const
+    {
+        poly_t r(k, 0);
+        r[0] = 1 % mod;
+
+        // mulai dari bit tertinggi n, pengkuadratan 1 tidak berguna
+        int bit = 63;
+        while (bit > 0 && ! ((n >> bit) & 1))
+            bit--;
+
+        for (; bit >= 0; bit--)
+        {
+            r = mul_mod(r, r);
+            if ((n >> bit) & 1)
+                r = mul_x(r);
+        }
+
+        return r;
+    }
+
+    uint64_t kitamasa(uint64_t n) const
+    {
+        if (n < k)
+            return init[n];
+
+        return combine(power_x(n));
+    }
+
+    // -----------------------------------------------------------------------------------
+
+    // iterasi langsung O(nk) untuk n kecil, Kitamasa untuk n besar
+    uint64_t operator()(uint64_t n) const
+    {
+        if (n < k)
+            return init[n];
+
+        size_t bits = 0;
+        for (uint64_t t = n; t; t >>= 1)
+            bits++;
+
+        if (n > 2 * k * bits)
+            return kitamasa(n);
+
+        poly_t window(init);            // a(i - k .. i - 1), melingkar
+        uint64_t value = 0;
+
+        for (uint64_t i = k; i <= n; i++)
+        {
+            uint128_t acc = 0;
+            for (size_t j = 0; j < k; j++)
+                accumulate(acc, coef[j], window[(i - 1 - j) % k], mod);
+
+            value = reduce(acc, mod);
+            window[i % k] = value;
+        }
+
+        return value;
+    }
+};
+
+uint64_t algorithm(uint64_t N, size_t K, uint64_t mod)
+{
+    if (K == 0)
+        return (N == 0) ? 1 % mod : 0;
+
+    std::vector<uint64_t> coef(K, 1), init(K, 0);
+
+    // nilai awal ways(0 .. K-1) dengan tabulation biasa
+    init[0] = 1 % mod;
+    for (size_t i = 1; i < K; i++)
+        for (size_t j = 0; j < i; j++)
+            init[i] = (init[i] + init[j]) % mod;
+
+    return recurrence_t(coef.data(), init.data(), K, mod)(N);
 }
\ No newline at end of file
@@ -18,6 +18,12 @@ Compile:
 Run:
     $ fibonacci-sequence
 */
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
 
 /*
 Masalah:
@@ -108,4 +114,109 @@ size_t algorithm(size_t N)
     }
 
     return b;
+}
+
+// ======================================================================================
+
+/** Recursive Solution -- Generic Memoization **/
+
+/*
+    Solusi memoization di atas dengan lookup table dan penanda 0 ditulis ulang
+    menggunakan memoize_t. Lookup table (dense_table_t) dialokasikan di heap.
+*/
+
+/*
+    memoize_t dan dense_table_t, sama seperti bagian Dynamic Programming
+    (dynamic-programming/c++/dynamic-programming-3.cpp)
+*/
+struct memo_stats_t
+{
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> compute_ns{0};     // total waktu komputasi saat miss
+
+    double hit_rate() const
+    {
+        uint64_t total = hits + misses;
+        return total ? (double) hits / total : 0.0;
+    }
+
+    // rata-rata latency komputasi per miss (nanodetik), termasuk sub-pemanggilan
+    double miss_latency() const
+    {
+        return misses ? (double) compute_ns / misses : 0.0;
+    }
+};
+
+template <typename Key, typename Value, typename Table>
+struct memoize_t
+{
+    typedef std::function<Value(memoize_t &, const Key &)> function_t;
+
+    function_t   fn;
+    Table        table;
+    memo_stats_t stats;
+
+    template <typename... Args>
+    memoize_t(function_t fn, Args &&... args)
+        : fn(std::move(fn)), table(std::forward<Args>(args)...) {}
+
+    Value operator()(const Key & key)
+    {
+        // evaluasi apakah nilai pada subproblem telah dicatat
+        if (Value * v = table.find(key))
+        {
+            stats.hits.fetch_add(1, std::memory_order_relaxed);
+            return *v;
+        }
+
+        stats.misses.fetch_add(1, std::memory_order_relaxed);
+
+        // komputasi dan simpan hasil ke dalam tabel
+        auto  start  = std::chrono::steady_clock::now();
+        Value result = fn(*this, key);
+        auto  elapsed = std::chrono::steady_clock::now() - start;
+
+        stats.compute_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+            std::memory_order_relaxed);
+
+        table.insert(key, result);
+        return result;
+    }
+};
+
+// dense_table_t tanpa snapshot ke disk (save/load)
+template <typename Value>
+struct dense_table_t
+{
+    std::vector<Value>   values;
+    std::vector<uint8_t> present;
+
+    explicit dense_table_t(size_t N = 0) : values(N), present(N, 0) {}
+
+    Value * find(size_t key)
+    {
+        return (key < values.size() && present[key]) ? &values[key] : nullptr;
+    }
+
+    void insert(size_t key, const Value & value)
+    {
+        if (key >= values.size())
+            return;
+
+        values[key]  = value;
+        present[key] = 1;
+    }
+};
+
+size_t algorithm(size_t N)
+{
+    memoize_t<size_t, size_t, dense_table_t<size_t>> memo(
+        [](auto & self, size_t n) -> size_t {
+            return (n < 2) ? n : self(n - 1) + self(n - 2);
+        },
+        N + 1);
+
+    return memo(N);
 }
\ No newline at end of file
@@ -17,6 +17,11 @@ Run:
     $ permutation-coefficient
 */
 #include <cstring>
+#include <vector>
+#include <cstdint>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 /*
     Permutation Coefficient didefinisikan sebagai:
@@ -83,4 +88,222 @@ int algorithm(size_t N, size_t K)
         table[i] = i * table[i - 1];
 
     return table[N] / table[N - K];
+}
+
+// ======================================================================================
+
+/** Modular Arithmetic -- Precomputed Factorial **/
+
+/*
+    Banyak query P(n, k) mod p dengan p prima dan n < p.
+
+    P(n, k) = n! * ((n - k)!)^-1  (mod p)
+
+    Menggunakan tabel faktorial dan invers faktorial yang sama dengan Binomial
+    Coefficient sehingga setiap query hanya membutuhkan satu perkalian, O(1).
+*/
+
+/*
+    modint_t beserta operasinya, sama seperti bagian Modular Arithmetic
+    (mathematic/c++/cases/numbers/modular-arithmetic.cpp)
+*/
+template <uint32_t M>
+struct modint_t
+{
+    uint32_t v;
+
+    constexpr modint_t(uint64_t x = 0) : v(x % M) {}
+
+    // bentuk dari nilai yang dipastikan sudah < M
+    static constexpr modint_t raw(uint32_t x)
+    {
+        modint_t r;
+        r.v = x;
+        return r;
+    }
+
+    constexpr modint_t operator+(modint_t b) const
+    {
+        uint32_t s = v + b.v;
+        return raw(s >= M ? s - M : s);
+    }
+
+    constexpr modint_t operator-(modint_t b) const
+    {
+        return raw(v >= b.v ? v - b.v : v + M - b.v);
+    }
+
+    constexpr modint_t operator*(modint_t b) const
+    {
+        return raw((uint64_t) v * b.v % M);
+    }
+
+    constexpr modint_t & operator+=(modint_t b) { return *this = *this + b; }
+    constexpr modint_t & operator-=(modint_t b) { return *this = *this - b; }
+    constexpr modint_t & operator*=(modint_t b) { return *this = *this * b; }
+
+    constexpr bool operator==(modint_t b) const { return v == b.v; }
+
+    // perpangkatan dengan binary exponentiation
+    constexpr modint_t pow(uint64_t exp) const
+    {
+        modint_t result(1), base = *this;
+
+        while (exp > 0)
+        {
+            if (exp & 1)
+                result *= base;
+
+            exp  >>= 1;
+            base *= base;
+        }
+
+        return result;
+    }
+
+    // invers dengan Fermat's little theorem, hanya berlaku bila M prima
+    constexpr modint_t inv() const
+    {
+        return pow(M - 2);
+    }
+};
+
+// tabel faktorial, sama seperti bagian Binomial Coefficient (Precomputed Factorial)
+template <uint32_t M>
+struct factorial_table_t
+{
+    std::vector<modint_t<M>> fact;
+    std::vector<modint_t<M>> inv_fact;
+
+    factorial_table_t(size_t N) : fact(N + 1), inv_fact(N + 1)
+    {
+        fact[0] = 1;
+        for (size_t i = 1; i <= N; i++)
+            fact[i] = fact[i - 1] * i;
+
+        inv_fact[N] = fact[N].inv();
+        for (size_t i = N; i > 0; i--)
+            inv_fact[i - 1] = inv_fact[i] * i;
+    }
+};
+
+template <uint32_t M>
+modint_t<M> algorithm(const factorial_table_t<M> & table, size_t N, size_t K)
+{
+    if (K > N)
+        return 0;
+
+    return table.fact[N] * table.inv_fact[N - K];
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- Parallel Wavefront Tabulation **/
+
+/*
+    Tabulasi pertama di atas dikerjakan oleh engine wavefront: tile pada anti-diagonal
+    yang sama dikerjakan paralel dan hanya baris yang masih dibutuhkan yang disimpan
+    (memori O(N + K)).
+
+    Nilai dihitung modulo mod agar N, K dalam rentang 1e5 tidak overflow.
+*/
+
+/*
+    wavefront() engine, sama seperti bagian Dynamic Programming
+    (dynamic-programming/c++/dynamic-programming-4.cpp)
+*/
+template <typename T, typename Cell>
+std::vector<T> wavefront(size_t rows, size_t cols, Cell cell, size_t tile = 512)
+{
+    size_t nbr = (rows + tile - 1) / tile;      // jumlah baris tile
+    size_t nbc = (cols + tile - 1) / tile;      // jumlah kolom tile
+
+    std::vector<T> top(cols, T());
+    std::vector<std::vector<T>> left(nbr, std::vector<T>(tile + 1, T()));
+
+    // proses satu tile dengan rolling row lokal
+    auto run_tile = [&](size_t bi, size_t bj)
+    {
+        size_t r0 = bi * tile, r1 = std::min(rows, r0 + tile);
+        size_t c0 = bj * tile, c1 = std::min(cols, c0 + tile);
+        size_t w  = c1 - c0;
+
+        // prev[0] adalah kolom di kiri tile, prev[1..w] baris di atas tile
+        std::vector<T> prev(w + 1), cur(w + 1);
+        std::vector<T> & lcol = left[bi];
+
+        prev[0] = (bj > 0) ? lcol[0] : T();
+        for (size_t j = 0; j < w; j++)
+            prev[j + 1] = top[c0 + j];
+
+        // corner untuk tile di kanan: nilai di atas kolom terakhir tile ini
+        T corner = prev[w];
+
+        for (size_t i = r0; i < r1; i++)
+        {
+            cur[0] = (bj > 0) ? lcol[i - r0 + 1] : T();
+
+            for (size_t j = 0; j < w; j++)
+                cur[j + 1] = cell(i, c0 + j, prev[j], prev[j + 1], cur[j]);
+
+            lcol[i - r0 + 1] = cur[w];
+            std::swap(prev, cur);
+        }
+
+        // publikasikan baris terakhir tile untuk tile di bawahnya
+        for (size_t j = 0; j < w; j++)
+            top[c0 + j] = prev[j + 1];
+        lcol[0] = corner;
+    };
+
+    size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // telusuri anti-diagonal tile
+    for (size_t d = 0; d + 1 < nbr + nbc; d++)
+    {
+        size_t bi_lo = (d >= nbc) ? d - nbc + 1 : 0;
+        size_t bi_hi = std::min(d, nbr - 1);
+        size_t count = bi_hi - bi_lo + 1;
+
+        // diagonal pendek dikerjakan langsung
+        if (count == 1 || nthreads == 1)
+        {
+            for (size_t bi = bi_lo; bi <= bi_hi; bi++)
+                run_tile(bi, d - bi);
+            continue;
+        }
+
+        std::atomic<size_t> next(bi_lo);
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0; t < std::min(nthreads, count); t++)
+        {
+            workers.emplace_back([&] {
+                size_t bi;
+                while ((bi = next++) <= bi_hi)
+                    run_tile(bi, d - bi);
+            });
+        }
+
+        for (auto & w : workers)
+            w.join();
+    }
+
+    return top;
+}
+
+uint64_t algorithm(size_t N, size_t K, uint64_t mod)
+{
+    auto row = wavefront<uint64_t>(N + 1, K + 1,
+        [mod](size_t i, size_t j, uint64_t diag, uint64_t up, uint64_t /* left */) -> uint64_t {
+            if (j == 0)
+                return 1 % mod;
+            if (i == 0)
+                return 0;
+
+            // P(i, j) = P(i - 1, j) + j * P(i - 1, j - 1)
+            return (up + (unsigned __int128) j * diag % mod) % mod;
+        });
+
+    return row[K];
 }
\ No newline at end of file
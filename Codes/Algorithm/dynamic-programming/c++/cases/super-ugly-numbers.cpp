@@ -16,6 +16,12 @@ Compile:
 Run:
     $ super-ugly-numbers
 */
+#include <deque>
+#include <queue>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <functional>
 
 /*
 Masalah:
@@ -89,7 +95,7 @@ size_t algorithm(size_t N, size_t primes[], size_t K)
         ugly[i] = next_ugly;
 
         // update nilai di baris
-        for (j = 0; j < N; j++)
+        for (j = 0; j < K; j++)
         {
             if (next_ugly == generator[j])
             {
@@ -101,4 +107,102 @@ size_t algorithm(size_t N, size_t primes[], size_t K)
 
     // ketika berakhir, telah dibangkitkan N - 1 bilangna
     return next_ugly;
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- K-way Merge with Min-Heap (Streaming) **/
+
+/*
+    Solusi di atas mencari minimum dengan linear scan terhadap K generator pada setiap
+    langkah (O(N * K)) dan menyimpan seluruh N bilangan di stack.
+
+    Perbaikan:
+    - K generator disimpan di min-heap berdasarkan nilai berikutnya sehingga minimum
+      didapat dalam O(1) dan pembaruan dalam O(log K). Duplikasi (misal 6 = 2 * 3 =
+      3 * 2) dibuang dengan mengambil semua generator yang bernilai sama.
+    - Bilangan dibangkitkan satu per satu (streaming). Generator untuk prima p selalu
+      menunjuk ke bilangan terkecil u dengan u * p > nilai terakhir, sehingga generator
+      dengan prima terbesar memiliki indeks paling kecil. Bilangan sebelum indeks
+      tersebut tidak akan dibaca lagi dan dibuang dari window.
+    - Perkalian yang melewati 64-bit membuat generator berhenti, bukan overflow.
+
+    Kompleksitas O(N log K) waktu.
+*/
+
+struct smooth_generator_t
+{
+    typedef std::pair<uint64_t, size_t> entry_t;     // (nilai berikutnya, generator)
+
+    std::vector<uint64_t> primes;
+    std::vector<uint64_t> index;        // indeks absolut ke window untuk tiap generator
+    std::deque<uint64_t>  window;       // bilangan yang masih dapat dibaca generator
+    uint64_t              base = 0;     // indeks absolut dari window[0]
+    size_t                largest = 0;  // generator dengan prima terbesar
+    bool                  started = false;
+
+    std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> heap;
+
+    smooth_generator_t(const size_t arr[], size_t K)
+        : primes(arr, arr + K), index(K, 0)
+    {
+        window.push_back(1);
+
+        for (size_t j = 0; j < K; j++)
+        {
+            heap.push(entry_t(primes[j], j));
+            if (primes[j] > primes[largest])
+                largest = j;
+        }
+    }
+
+    // bangkitkan bilangan berikutnya, false bila semua generator melewati 64-bit
+    bool next(uint64_t & value)
+    {
+        // bilangan pertama selalu 1
+        if (! started)
+        {
+            started = true;
+            value = 1;
+            return true;
+        }
+
+        if (heap.empty())
+            return false;
+
+        value = heap.top().first;
+        window.push_back(value);
+
+        // majukan semua generator yang menghasilkan nilai yang sama
+        while (! heap.empty() && heap.top().first == value)
+        {
+            size_t j = heap.top().second;
+            heap.pop();
+
+            uint64_t next_value;
+            index[j] ++;
+            if (! __builtin_mul_overflow(window[index[j] - base], primes[j], &next_value))
+                heap.push(entry_t(next_value, j));
+        }
+
+        // buang bilangan yang tidak akan dibaca lagi oleh generator manapun
+        while (base < index[largest])
+        {
+            window.pop_front();
+            base ++;
+        }
+
+        return true;
+    }
+};
+
+size_t algorithm(size_t N, size_t primes[], size_t K)
+{
+    smooth_generator_t generator(primes, K);
+    uint64_t value = 1;
+
+    for (size_t i = 0; i < N && generator.next(value); i++)
+        ;
+
+    return value;
 }
\ No newline at end of file
@@ -16,6 +16,14 @@ Compile:
 Run:
     $ ugly-numbers
 */
+#include <deque>
+#include <queue>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <functional>
 
 /*
 Masalah:
@@ -98,4 +106,97 @@ size_t algorithm(size_t N)
 
     // ketika berakhir, telah dibangkitkan N - 1 bilangna
     return next_ugly;
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- Shared Smooth Number Generator **/
+
+/*
+    Ugly Number merupakan Super Ugly Number dengan faktor prima {2, 3, 5}. Generator
+    heap yang sama digunakan sehingga bilangan dibangkitkan secara streaming tanpa
+    menyimpan seluruh N bilangan.
+*/
+
+/*
+    generator bilangan smooth, sama seperti bagian Super Ugly Numbers (K-way Merge)
+    (dynamic-programming/c++/cases/super-ugly-numbers.cpp)
+*/
+struct smooth_generator_t
+{
+    typedef std::pair<uint64_t, size_t> entry_t;     // (nilai berikutnya, generator)
+
+    std::vector<uint64_t> primes;
+    std::vector<uint64_t> index;        // indeks absolut ke window untuk tiap generator
+    std::deque<uint64_t>  window;       // bilangan yang masih dapat dibaca generator
+    uint64_t              base = 0;     // indeks absolut dari window[0]
+    size_t                largest = 0;  // generator dengan prima terbesar
+    bool                  started = false;
+
+    std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> heap;
+
+    smooth_generator_t(const size_t arr[], size_t K)
+        : primes(arr, arr + K), index(K, 0)
+    {
+        window.push_back(1);
+
+        for (size_t j = 0; j < K; j++)
+        {
+            heap.push(entry_t(primes[j], j));
+            if (primes[j] > primes[largest])
+                largest = j;
+        }
+    }
+
+    // bangkitkan bilangan berikutnya, false bila semua generator melewati 64-bit
+    bool next(uint64_t & value)
+    {
+        // bilangan pertama selalu 1
+        if (! started)
+        {
+            started = true;
+            value = 1;
+            return true;
+        }
+
+        if (heap.empty())
+            return false;
+
+        value = heap.top().first;
+        window.push_back(value);
+
+        // majukan semua generator yang menghasilkan nilai yang sama
+        while (! heap.empty() && heap.top().first == value)
+        {
+            size_t j = heap.top().second;
+            heap.pop();
+
+            uint64_t next_value;
+            index[j] ++;
+            if (! __builtin_mul_overflow(window[index[j] - base], primes[j], &next_value))
+                heap.push(entry_t(next_value, j));
+        }
+
+        // buang bilangan yang tidak akan dibaca lagi oleh generator manapun
+        while (base < index[largest])
+        {
+            window.pop_front();
+            base ++;
+        }
+
+        return true;
+    }
+};
+
+size_t algorithm(size_t N)
+{
+    const size_t primes[] = {2, 3, 5};
+
+    smooth_generator_t generator(primes, 3);
+    uint64_t value = 1;
+
+    for (size_t i = 0; i < N && generator.next(value); i++)
+        ;
+
+    return value;
 }
\ No newline at end of file
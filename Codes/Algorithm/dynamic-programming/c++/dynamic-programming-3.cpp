@@ -0,0 +1,589 @@
+/*
+    Dynamic Programming
+    Archive of Reversing.ID
+    Algorithm
+
+    Dynamic Programming dengan pendekatan Memoization generik.
+
+
+Compile:
+    [clang]
+    $ clang++ -std=c++17 -pthread dynamic-programming-3.cpp -o dynamic-programming
+
+    [gcc]
+    $ g++ -std=c++17 -pthread dynamic-programming-3.cpp -o dynamic-programming
+
+Run:
+    $ dynamic-programming
+*/
+#include <vector>
+#include <list>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <utility>
+#include <functional>
+#include <unordered_map>
+#include <type_traits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*
+    Memoization
+    Top-down approach.
+
+    Pada dynamic-programming-1.cpp, lookup table berupa array global berukuran tetap
+    dengan nilai NIL sebagai penanda. Setiap kasus menyalin pola yang sama.
+
+    Di sini lookup table dipisahkan dari fungsi rekursif:
+
+        memoize_t<Key, Value, Table>
+
+    dengan Table merupakan salah satu backend berikut:
+    - dense_table_t       key bilangan bulat [0, N), array biasa. Dapat disimpan ke
+                          disk dan di-mmap kembali saat startup.
+    - hash_table_t        key sembarang (misal tuple), open-addressing dengan linear
+                          probing. Hash default hash_t juga menangani std::tuple dan
+                          std::pair.
+    - lru_table_t         key sembarang dengan batas jumlah entry (Least Recently Used).
+    - concurrent_table_t  key 64-bit, lock-free dan dibagi menjadi beberapa shard
+                          sehingga beberapa thread dapat berbagi hasil komputasi.
+
+    Semua backend menyediakan:
+        Value * find(const Key & key)       nullptr bila belum tercatat
+        void    insert(const Key & key, const Value & value)
+
+    memoize_t mencatat jumlah hit, miss, dan waktu komputasi (latency) saat miss.
+*/
+
+// ======================================================================================
+
+/** Dense Table -- key bilangan bulat **/
+
+template <typename Value>
+struct dense_table_t
+{
+    static_assert(std::is_trivially_copyable<Value>::value,
+        "snapshot membutuhkan Value yang dapat disalin per byte");
+
+    struct header_t
+    {
+        char     magic[8];
+        uint64_t size;
+        uint64_t value_size;
+        uint64_t reserved;
+    };
+
+    size_t    size = 0;
+    Value   * values = nullptr;
+    uint8_t * present = nullptr;
+
+    // penyimpanan: buffer milik sendiri atau region hasil mmap
+    std::vector<uint8_t> buffer;
+    void   * mapping = nullptr;
+    size_t   mapping_size = 0;
+
+    static size_t bytes(size_t N)
+    {
+        return sizeof(header_t) + N * sizeof(Value) + N;
+    }
+
+    explicit dense_table_t(size_t N = 0)
+    {
+        buffer.assign(bytes(N), 0);
+        attach(buffer.data(), N);
+    }
+
+    dense_table_t(const dense_table_t &) = delete;
+    dense_table_t & operator=(const dense_table_t &) = delete;
+
+    ~dense_table_t()
+    {
+        release();
+    }
+
+    Value * find(size_t key)
+    {
+        return (key < size && present[key]) ? &values[key] : nullptr;
+    }
+
+    void insert(size_t key, const Value & value)
+    {
+        if (key >= size)
+            return;
+
+        values[key]  = value;
+        present[key] = 1;
+    }
+
+    // tulis seluruh tabel ke disk
+    bool save(const char * path) const
+    {
+        FILE * fp = fopen(path, "wb");
+        if (! fp)
+            return false;
+
+        header_t h = {};
+        memcpy(h.magic, "MEMOTBL", 8);
+        h.size       = size;
+        h.value_size = sizeof(Value);
+
+        bool ok = fwrite(&h, sizeof(h), 1, fp) == 1 &&
+                  fwrite(values,  sizeof(Value), size, fp) == size &&
+                  fwrite(present, 1,             size, fp) == size;
+
+        return (fclose(fp) == 0) && ok;
+    }
+
+    /*
+    Muat tabel dari disk. Pada POSIX file di-mmap secara MAP_PRIVATE (copy-on-write)
+    sehingga startup tidak perlu membaca seluruh file dan tabel tetap dapat diisi.
+    */
+    bool load(const char * path)
+    {
+#ifndef _WIN32
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(header_t))
+        {
+            close(fd);
+            return false;
+        }
+
+        void * map = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (map == MAP_FAILED)
+            return false;
+
+        const header_t * h = (const header_t *) map;
+        if (memcmp(h->magic, "MEMOTBL", 8) != 0 || h->value_size != sizeof(Value) ||
+            bytes(h->size) != (size_t) st.st_size)
+        {
+            munmap(map, st.st_size);
+            return false;
+        }
+
+        release();
+        mapping      = map;
+        mapping_size = st.st_size;
+        attach((uint8_t *) map, h->size);
+        return true;
+#else
+        FILE * fp = fopen(path, "rb");
+        if (! fp)
+            return false;
+
+        header_t h;
+        bool ok = fread(&h, sizeof(h), 1, fp) == 1 &&
+                  memcmp(h.magic, "MEMOTBL", 8) == 0 && h.value_size == sizeof(Value);
+        if (ok)
+        {
+            std::vector<uint8_t> data(bytes(h.size));
+            memcpy(data.data(), &h, sizeof(h));
+            ok = fread(data.data() + sizeof(h), 1, data.size() - sizeof(h), fp) ==
+                 data.size() - sizeof(h);
+            if (ok)
+            {
+                release();
+                buffer.swap(data);
+                attach(buffer.data(), h.size);
+            }
+        }
+
+        fclose(fp);
+        return ok;
+#endif
+    }
+
+private:
+    void attach(uint8_t * base, size_t N)
+    {
+        size    = N;
+        values  = (Value *) (base + sizeof(header_t));
+        present = base + sizeof(header_t) + N * sizeof(Value);
+    }
+
+    void release()
+    {
+#ifndef _WIN32
+        if (mapping)
+            munmap(mapping, mapping_size);
+#endif
+        mapping = nullptr;
+        buffer.clear();
+    }
+};
+
+// ======================================================================================
+
+/** Hash -- tuple dan pair **/
+
+/*
+    std::hash tidak memiliki spesialisasi untuk std::tuple dan std::pair sehingga key
+    berupa tuple tidak dapat langsung digunakan pada hash_table_t dan lru_table_t.
+    hash_t meneruskan tipe lain ke std::hash, sedangkan hash tuple dan pair dibentuk
+    dengan menggabungkan hash setiap elemen (hash_combine). Elemen tuple boleh berupa
+    tuple lagi.
+*/
+
+template <typename T>
+struct hash_t
+{
+    size_t operator()(const T & key) const
+    {
+        return std::hash<T>()(key);
+    }
+};
+
+static inline
+size_t hash_combine(size_t seed, size_t h)
+{
+    return seed ^ (h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+template <typename... Ts>
+struct hash_t<std::tuple<Ts...>>
+{
+    size_t operator()(const std::tuple<Ts...> & key) const
+    {
+        return combine(key, std::index_sequence_for<Ts...>());
+    }
+
+private:
+    template <size_t... I>
+    static size_t combine(const std::tuple<Ts...> & key, std::index_sequence<I...>)
+    {
+        size_t seed = 0;
+        ((seed = hash_combine(seed, hash_t<Ts>()(std::get<I>(key)))), ...);
+        return seed;
+    }
+};
+
+template <typename A, typename B>
+struct hash_t<std::pair<A, B>>
+{
+    size_t operator()(const std::pair<A, B> & key) const
+    {
+        return hash_combine(hash_t<A>()(key.first), hash_t<B>()(key.second));
+    }
+};
+
+// ======================================================================================
+
+/** Hash Table -- open addressing, linear probing **/
+
+/*
+    Key dan value disimpan berdampingan dalam satu array sehingga satu probe hanya
+    menyentuh satu cache line. Kapasitas selalu pangkat dua dan tabel diperbesar dua
+    kali lipat ketika load factor melewati 1/2.
+*/
+
+template <typename Key, typename Value, typename Hash = hash_t<Key>>
+struct hash_table_t
+{
+    struct slot_t
+    {
+        Key   key;
+        Value value;
+        bool  used;
+    };
+
+    std::vector<slot_t> slots;
+    size_t count = 0;
+    Hash   hasher;
+
+    explicit hash_table_t(size_t capacity = 16)
+    {
+        size_t n = 16;
+        while (n < 2 * capacity)
+            n <<= 1;
+        slots.assign(n, slot_t{Key(), Value(), false});
+    }
+
+    Value * find(const Key & key)
+    {
+        size_t mask = slots.size() - 1;
+
+        for (size_t i = mix(hasher(key)) & mask; slots[i].used; i = (i + 1) & mask)
+        {
+            if (slots[i].key == key)
+                return &slots[i].value;
+        }
+
+        return nullptr;
+    }
+
+    void insert(const Key & key, const Value & value)
+    {
+        if (2 * (count + 1) > slots.size())
+            grow();
+
+        size_t mask = slots.size() - 1;
+        size_t i    = mix(hasher(key)) & mask;
+
+        while (slots[i].used && ! (slots[i].key == key))
+            i = (i + 1) & mask;
+
+        if (! slots[i].used)
+            count ++;
+
+        slots[i] = slot_t{key, value, true};
+    }
+
+private:
+    // std::hash untuk integer adalah identitas, campur bit agar probing merata
+    static size_t mix(size_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    void grow()
+    {
+        std::vector<slot_t> old(slots.size() * 2, slot_t{Key(), Value(), false});
+        old.swap(slots);
+        count = 0;
+
+        for (auto & s : old)
+            if (s.used)
+                insert(s.key, s.value);
+    }
+};
+
+// ======================================================================================
+
+/** LRU Table -- jumlah entry dibatasi **/
+
+/*
+    Ketika jumlah entry mencapai batas, entry yang paling lama tidak diakses dibuang.
+    Urutan akses dicatat dengan doubly-linked list, lookup dengan hash map.
+*/
+
+template <typename Key, typename Value, typename Hash = hash_t<Key>>
+struct lru_table_t
+{
+    typedef std::pair<Key, Value> entry_t;
+
+    size_t limit;
+    std::list<entry_t> order;       // depan: paling baru diakses
+    std::unordered_map<Key, typename std::list<entry_t>::iterator, Hash> index;
+
+    explicit lru_table_t(size_t limit) : limit(limit) {}
+
+    Value * find(const Key & key)
+    {
+        auto it = index.find(key);
+        if (it == index.end())
+            return nullptr;
+
+        // pindahkan ke depan
+        order.splice(order.begin(), order, it->second);
+        return &it->second->second;
+    }
+
+    void insert(const Key & key, const Value & value)
+    {
+        if (Value * v = find(key))
+        {
+            *v = value;
+            return;
+        }
+
+        if (index.size() >= limit && ! order.empty())
+        {
+            index.erase(order.back().first);
+            order.pop_back();
+        }
+
+        order.emplace_front(key, value);
+        index[key] = order.begin();
+    }
+};
+
+// ======================================================================================
+
+/** Concurrent Table -- sharded, lock-free **/
+
+/*
+    Insert-only hash table untuk key 64-bit (kecuali UINT64_MAX) dan Value yang dapat
+    disalin per byte. Tidak ada resize: bila shard penuh, hasil tidak disimpan (cache
+    bersifat best-effort dan komputasi ulang tetap menghasilkan nilai yang sama).
+
+    Slot diklaim dengan compare-and-swap pada key. Value ditulis terlebih dahulu,
+    kemudian flag ready dipublikasikan dengan release store sehingga pembaca yang melihat
+    ready = 1 (acquire) selalu membaca value yang lengkap.
+
+    Shard dipilih dari bit tinggi hash sehingga thread yang bekerja pada key berbeda
+    cenderung menyentuh memori yang berbeda.
+*/
+
+template <typename Value>
+struct concurrent_table_t
+{
+    static_assert(std::is_trivially_copyable<Value>::value,
+        "Value harus dapat disalin per byte");
+
+    struct slot_t
+    {
+        std::atomic<uint64_t> key{0};       // 0 = kosong, selain itu key + 1
+        std::atomic<uint8_t>  ready{0};
+        Value value;
+    };
+
+    size_t shard_bits;
+    size_t shard_mask;
+    std::vector<std::unique_ptr<slot_t[]>> shards;
+
+    concurrent_table_t(size_t capacity, size_t shard_bits = 4) : shard_bits(shard_bits)
+    {
+        size_t per_shard = 16;
+        while (per_shard < 2 * (capacity >> shard_bits))
+            per_shard <<= 1;
+
+        shard_mask = per_shard - 1;
+        for (size_t i = 0; i < ((size_t) 1 << shard_bits); i++)
+            shards.emplace_back(new slot_t[per_shard]);
+    }
+
+    Value * find(uint64_t key)
+    {
+        uint64_t h = mix(key);
+        slot_t * shard = shards[h >> (64 - shard_bits)].get();
+
+        for (size_t n = 0, i = h & shard_mask; n <= shard_mask; n++, i = (i + 1) & shard_mask)
+        {
+            uint64_t k = shard[i].key.load(std::memory_order_acquire);
+
+            if (k == 0)
+                return nullptr;
+            if (k == key + 1)
+                return shard[i].ready.load(std::memory_order_acquire) ? &shard[i].value
+                                                                      : nullptr;
+        }
+
+        return nullptr;
+    }
+
+    void insert(uint64_t key, const Value & value)
+    {
+        uint64_t h = mix(key);
+        slot_t * shard = shards[h >> (64 - shard_bits)].get();
+
+        for (size_t n = 0, i = h & shard_mask; n <= shard_mask; n++, i = (i + 1) & shard_mask)
+        {
+            uint64_t k = shard[i].key.load(std::memory_order_acquire);
+
+            if (k == 0 &&
+                shard[i].key.compare_exchange_strong(k, key + 1, std::memory_order_acq_rel))
+            {
+                shard[i].value = value;
+                shard[i].ready.store(1, std::memory_order_release);
+                return;
+            }
+
+            // sudah dimasukkan oleh thread lain
+            if (k == key + 1)
+                return;
+        }
+    }
+
+private:
+    static uint64_t mix(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+};
+
+// ======================================================================================
+
+/** memoize_t **/
+
+/*
+    Fungsi rekursif menerima referensi ke memoize_t sehingga pemanggilan rekursif
+    juga melewati lookup table:
+
+        memoize_t<size_t, size_t, dense_table_t<size_t>> fib(
+            [](auto & self, size_t n) -> size_t {
+                return (n < 2) ? n : self(n - 1) + self(n - 2);
+            },
+            N + 1);
+
+    Counter bersifat atomic sehingga aman digunakan bersama concurrent_table_t.
+*/
+
+struct memo_stats_t
+{
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> compute_ns{0};     // total waktu komputasi saat miss
+
+    double hit_rate() const
+    {
+        uint64_t total = hits + misses;
+        return total ? (double) hits / total : 0.0;
+    }
+
+    // rata-rata latency komputasi per miss (nanodetik), termasuk sub-pemanggilan
+    double miss_latency() const
+    {
+        return misses ? (double) compute_ns / misses : 0.0;
+    }
+};
+
+template <typename Key, typename Value, typename Table>
+struct memoize_t
+{
+    typedef std::function<Value(memoize_t &, const Key &)> function_t;
+
+    function_t   fn;
+    Table        table;
+    memo_stats_t stats;
+
+    template <typename... Args>
+    memoize_t(function_t fn, Args &&... args)
+        : fn(std::move(fn)), table(std::forward<Args>(args)...) {}
+
+    Value operator()(const Key & key)
+    {
+        // evaluasi apakah nilai pada subproblem telah dicatat
+        if (Value * v = table.find(key))
+        {
+            stats.hits.fetch_add(1, std::memory_order_relaxed);
+            return *v;
+        }
+
+        stats.misses.fetch_add(1, std::memory_order_relaxed);
+
+        // komputasi dan simpan hasil ke dalam tabel
+        auto  start  = std::chrono::steady_clock::now();
+        Value result = fn(*this, key);
+        auto  elapsed = std::chrono::steady_clock::now() - start;
+
+        stats.compute_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+            std::memory_order_relaxed);
+
+        table.insert(key, result);
+        return result;
+    }
+};
\ No newline at end of file
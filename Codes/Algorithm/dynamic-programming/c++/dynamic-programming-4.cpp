@@ -0,0 +1,138 @@
+/*
+    Dynamic Programming
+    Archive of Reversing.ID
+    Algorithm
+
+    Dynamic Programming dengan pendekatan Tabulation paralel (wavefront).
+
+
+Compile:
+    [clang]
+    $ clang++ -std=c++14 -pthread dynamic-programming-4.cpp -o dynamic-programming
+
+    [gcc]
+    $ g++ -std=c++14 -pthread dynamic-programming-4.cpp -o dynamic-programming
+
+Run:
+    $ dynamic-programming
+*/
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+/*
+    Tabulation
+    Bottom-up approach.
+
+    Banyak rekurens 2 dimensi hanya bergantung pada tetangga terdekat:
+
+        table[i][j] = f(i, j, table[i - 1][j - 1], table[i - 1][j], table[i][j - 1])
+
+    Pengisian baris per baris tidak dapat diparalelkan karena table[i][j] bergantung pada
+    table[i][j - 1]. Namun semua cell pada anti-diagonal yang sama (i + j konstan) saling
+    independen.
+
+    Engine di bawah membagi tabel menjadi tile berukuran T x T. Tile (bi, bj) hanya
+    bergantung pada tile di atas, kiri, dan kiri-atas, sehingga tile pada anti-diagonal
+    tile yang sama (bi + bj konstan) dapat dikerjakan oleh thread berbeda:
+
+        d = 0:  (0,0)
+        d = 1:  (0,1) (1,0)
+        d = 2:  (0,2) (1,1) (2,0)
+        ...
+
+    Tabel penuh tidak pernah disimpan. Yang disimpan hanyalah:
+    - top   : satu baris selebar tabel, baris terakhir dari tile di atas tiap kolom tile
+    - left  : satu kolom setinggi T (+1 corner) untuk setiap baris tile
+    Memori O(rows + cols) bukan O(rows * cols).
+
+    Interface deklaratif: cukup berikan ukuran tabel dan fungsi cell
+
+        T cell(size_t i, size_t j, T diag, T up, T left)
+
+    Nilai di luar tabel (i = 0 atau j = 0) diberikan sebagai T(). Engine mengembalikan
+    baris terakhir tabel.
+*/
+
+// ======================================================================================
+
+template <typename T, typename Cell>
+std::vector<T> wavefront(size_t rows, size_t cols, Cell cell, size_t tile = 512)
+{
+    size_t nbr = (rows + tile - 1) / tile;      // jumlah baris tile
+    size_t nbc = (cols + tile - 1) / tile;      // jumlah kolom tile
+
+    std::vector<T> top(cols, T());
+    std::vector<std::vector<T>> left(nbr, std::vector<T>(tile + 1, T()));
+
+    // proses satu tile dengan rolling row lokal
+    auto run_tile = [&](size_t bi, size_t bj)
+    {
+        size_t r0 = bi * tile, r1 = std::min(rows, r0 + tile);
+        size_t c0 = bj * tile, c1 = std::min(cols, c0 + tile);
+        size_t w  = c1 - c0;
+
+        // prev[0] adalah kolom di kiri tile, prev[1..w] baris di atas tile
+        std::vector<T> prev(w + 1), cur(w + 1);
+        std::vector<T> & lcol = left[bi];
+
+        prev[0] = (bj > 0) ? lcol[0] : T();
+        for (size_t j = 0; j < w; j++)
+            prev[j + 1] = top[c0 + j];
+
+        // corner untuk tile di kanan: nilai di atas kolom terakhir tile ini
+        T corner = prev[w];
+
+        for (size_t i = r0; i < r1; i++)
+        {
+            cur[0] = (bj > 0) ? lcol[i - r0 + 1] : T();
+
+            for (size_t j = 0; j < w; j++)
+                cur[j + 1] = cell(i, c0 + j, prev[j], prev[j + 1], cur[j]);
+
+            lcol[i - r0 + 1] = cur[w];
+            std::swap(prev, cur);
+        }
+
+        // publikasikan baris terakhir tile untuk tile di bawahnya
+        for (size_t j = 0; j < w; j++)
+            top[c0 + j] = prev[j + 1];
+        lcol[0] = corner;
+    };
+
+    size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // telusuri anti-diagonal tile
+    for (size_t d = 0; d + 1 < nbr + nbc; d++)
+    {
+        size_t bi_lo = (d >= nbc) ? d - nbc + 1 : 0;
+        size_t bi_hi = std::min(d, nbr - 1);
+        size_t count = bi_hi - bi_lo + 1;
+
+        // diagonal pendek dikerjakan langsung
+        if (count == 1 || nthreads == 1)
+        {
+            for (size_t bi = bi_lo; bi <= bi_hi; bi++)
+                run_tile(bi, d - bi);
+            continue;
+        }
+
+        std::atomic<size_t> next(bi_lo);
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0; t < std::min(nthreads, count); t++)
+        {
+            workers.emplace_back([&] {
+                size_t bi;
+                while ((bi = next++) <= bi_hi)
+                    run_tile(bi, d - bi);
+            });
+        }
+
+        for (auto & w : workers)
+            w.join();
+    }
+
+    return top;
+}
\ No newline at end of file
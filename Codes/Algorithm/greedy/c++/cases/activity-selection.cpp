@@ -16,6 +16,9 @@ Compile:
 Run:
     $ activity-selection
 */
+#include <vector>
+#include <cstdint>
+#include <algorithm>
 
 /*
 Masalah:
@@ -93,4 +96,284 @@ auto algorithm(int start[], int finish[],size_t size)
     }
 
     return result;
-}
\ No newline at end of file
+}
+
+// ======================================================================================
+
+/** 
+    Online Solution -- Interval Tree (Treap)
+    aktivitas dapat ditambah dan dihapus kapan saja, query dilakukan tanpa sorting ulang.
+**/
+
+/*
+    Aktivitas disimpan dalam treap (binary search tree dengan prioritas acak, sehingga
+    tinggi tree O(log n) dengan ekspektasi) terurut berdasarkan (start, finish, act_id).
+    Setiap node menyimpan ringkasan subtree:
+    - best       : node dengan finish terkecil di subtree
+    - max_finish : finish terbesar di subtree (augmented interval tree)
+
+    Operasi:
+    - insert / remove                       O(log n)
+    - earliest_finish(t): aktivitas dengan start >= t dan finish terkecil, O(log n)
+    - overlaps(lo, hi): aktivitas yang beririsan dengan [lo, hi), O(min(n, k log n)).
+      Pruning hanya dengan max_finish sehingga setiap hasil dapat membutuhkan satu
+      penelusuran dari akar
+    - window(lo, hi): himpunan aktivitas kompatibel maksimum di dalam [lo, hi).
+      Greedy yang sama dengan solusi offline, setiap langkah adalah satu query
+      earliest_finish, O((k + 1) log n) dengan k jumlah aktivitas terpilih.
+
+    Untuk input batch, assign() membangun treap dari array dalam O(n log n) untuk sorting
+    ditambah O(n) untuk konstruksi (tanpa n kali insert).
+
+    Aktivitas harus memiliki durasi positif (start < finish).
+*/
+
+struct activity_scheduler_t
+{
+    struct node_t
+    {
+        activity_t act;
+        uint32_t   prio;
+        int        left, right;
+        int        best;
+        int        max_finish;
+    };
+
+    std::vector<node_t> pool;
+    std::vector<int>    free_list;
+    int      root = -1;
+    uint32_t seed = 2463534242u;
+
+    static bool less(const activity_t & a, const activity_t & b)
+    {
+        if (a.start != b.start)
+            return a.start < b.start;
+        if (a.finish != b.finish)
+            return a.finish < b.finish;
+        return a.act_id < b.act_id;
+    }
+
+    int create(const activity_t & act)
+    {
+        // xorshift32 sebagai prioritas
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        node_t node = { act, seed, -1, -1, 0, act.finish };
+        int t;
+
+        if (! free_list.empty())
+        {
+            t = free_list.back();
+            free_list.pop_back();
+            pool[t] = node;
+        }
+        else
+        {
+            t = pool.size();
+            pool.push_back(node);
+        }
+
+        pool[t].best = t;
+        return t;
+    }
+
+    int finish(int t) const
+    {
+        return pool[t].act.finish;
+    }
+
+    // hitung ulang ringkasan subtree
+    void pull(int t)
+    {
+        node_t & n = pool[t];
+
+        n.best       = t;
+        n.max_finish = n.act.finish;
+
+        for (int c : { n.left, n.right })
+        {
+            if (c < 0)
+                continue;
+
+            if (finish(pool[c].best) < finish(n.best))
+                n.best = pool[c].best;
+            n.max_finish = std::max(n.max_finish, pool[c].max_finish);
+        }
+    }
+
+    // l berisi key < act (atau <= act bila inclusive), r berisi sisanya
+    void split(int t, const activity_t & act, bool inclusive, int & l, int & r)
+    {
+        if (t < 0)
+        {
+            l = r = -1;
+            return;
+        }
+
+        bool go_left = inclusive ? ! less(act, pool[t].act) : less(pool[t].act, act);
+        if (go_left)
+        {
+            split(pool[t].right, act, inclusive, pool[t].right, r);
+            l = t;
+        }
+        else
+        {
+            split(pool[t].left, act, inclusive, l, pool[t].left);
+            r = t;
+        }
+
+        pull(t);
+    }
+
+    // seluruh key di l lebih kecil dari seluruh key di r
+    int merge(int l, int r)
+    {
+        if (l < 0) return r;
+        if (r < 0) return l;
+
+        if (pool[l].prio > pool[r].prio)
+        {
+            pool[l].right = merge(pool[l].right, r);
+            pull(l);
+            return l;
+        }
+
+        pool[r].left = merge(l, pool[r].left);
+        pull(r);
+        return r;
+    }
+
+    bool insert(const activity_t & act)
+    {
+        if (act.start >= act.finish)
+            return false;
+
+        int l, r;
+        split(root, act, false, l, r);
+        root = merge(merge(l, create(act)), r);
+        return true;
+    }
+
+    bool remove(const activity_t & act)
+    {
+        int l, m, r;
+        split(root, act, false, l, r);
+        split(r, act, true, m, r);
+
+        // m dapat berisi beberapa salinan identik, lepaskan tepat satu node (akar m)
+        bool found = (m >= 0);
+        if (found)
+        {
+            free_list.push_back(m);
+            m = merge(pool[m].left, pool[m].right);
+        }
+
+        root = merge(merge(l, m), r);
+        return found;
+    }
+
+    // aktivitas dengan start >= from dan finish terkecil, -1 bila tidak ada
+    int earliest_finish(int from) const
+    {
+        int t = root, best = -1;
+
+        while (t >= 0)
+        {
+            const node_t & n = pool[t];
+
+            if (n.act.start >= from)
+            {
+                // node ini dan seluruh subtree kanan memenuhi syarat
+                int cand = t;
+                if (n.right >= 0 && finish(pool[n.right].best) < finish(cand))
+                    cand = pool[n.right].best;
+                if (best < 0 || finish(cand) < finish(best))
+                    best = cand;
+
+                t = n.left;
+            }
+            else
+                t = n.right;
+        }
+
+        return best;
+    }
+
+    void overlaps(int t, int lo, int hi, std::vector<activity_t> & out) const
+    {
+        // tidak ada aktivitas di subtree yang berakhir setelah lo
+        if (t < 0 || pool[t].max_finish <= lo)
+            return;
+
+        overlaps(pool[t].left, lo, hi, out);
+
+        if (pool[t].act.start < hi)
+        {
+            if (pool[t].act.finish > lo)
+                out.push_back(pool[t].act);
+            overlaps(pool[t].right, lo, hi, out);
+        }
+    }
+
+    // aktivitas yang beririsan dengan [lo, hi), terurut berdasarkan start
+    std::vector<activity_t> overlaps(int lo, int hi) const
+    {
+        std::vector<activity_t> out;
+        overlaps(root, lo, hi, out);
+        return out;
+    }
+
+    // himpunan aktivitas kompatibel maksimum di dalam [lo, hi)
+    std::vector<activity_t> window(int lo, int hi) const
+    {
+        std::vector<activity_t> result;
+
+        for (int t; (t = earliest_finish(lo)) >= 0 && finish(t) <= hi; lo = finish(t))
+            result.push_back(pool[t].act);
+
+        return result;
+    }
+
+    // bulk-load: bangun treap dari array dalam O(n) setelah sorting
+    void assign(const activity_t arr[], size_t size)
+    {
+        std::vector<activity_t> sorted;
+        for (size_t i = 0; i < size; i++)
+            if (arr[i].start < arr[i].finish)
+                sorted.push_back(arr[i]);
+        std::sort(sorted.begin(), sorted.end(), less);
+
+        pool.clear();
+        free_list.clear();
+        root = -1;
+
+        // konstruksi cartesian tree dengan stack (rightmost path)
+        std::vector<int> stack;
+        for (const auto & act : sorted)
+        {
+            int t = create(act), last = -1;
+
+            while (! stack.empty() && pool[stack.back()].prio < pool[t].prio)
+            {
+                last = stack.back();
+                stack.pop_back();
+                pull(last);
+            }
+
+            pool[t].left = last;
+            if (! stack.empty())
+                pool[stack.back()].right = t;
+            stack.push_back(t);
+        }
+
+        // dasar stack merupakan root
+        root = stack.empty() ? -1 : stack.front();
+        while (! stack.empty())
+        {
+            pull(stack.back());
+            stack.pop_back();
+        }
+    }
+};
\ No newline at end of file
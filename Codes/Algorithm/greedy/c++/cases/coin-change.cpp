@@ -17,6 +17,8 @@ Run:
     $ coin-change
 */
 #include <vector>
+#include <cstdint>
+#include <climits>
 #include <algorithm>
 
 /*
@@ -53,5 +55,189 @@ auto algorithm(int denomination[], size_t size, int val)
         }
     }
 
+    return result;
+}
+
+// ======================================================================================
+
+/*
+    Greedy hanya optimal untuk sistem koin tertentu (canonical), misal {1, 2, 5, 10}.
+    Untuk sistem non-canonical seperti {1, 3, 4} dan V = 6, greedy menghasilkan
+    4 + 1 + 1 (3 koin) padahal solusi optimal adalah 3 + 3 (2 koin).
+
+    Solusi di bawah memisahkan persiapan sistem koin (sekali) dari penyelesaian
+    (berkali-kali):
+    - coin_system_t mengurutkan denomination satu kali dan mendeteksi apakah sistem
+      canonical.
+    - bila canonical, greedy dengan pembagian (bukan pengurangan satu per satu).
+    - bila tidak, dynamic programming O(n * V) yang selalu optimal.
+*/
+
+// ======================================================================================
+
+/** Dynamic Programming -- Minimum Coins **/
+
+/*
+    table[v] = jumlah koin minimum untuk menukar nilai v
+    table[v] = min(table[v - d] + 1) untuk setiap denomination d <= v
+
+    last[v] mencatat koin terakhir yang dipakai sehingga komposisi dapat direkonstruksi.
+    Mengembalikan senarai kosong bila V tidak dapat ditukar.
+*/
+
+auto algorithm(const int denomination[], size_t size, int val)
+{
+    std::vector<int> result;
+    std::vector<int> table(val + 1, INT_MAX);
+    std::vector<int> last(val + 1, 0);
+
+    table[0] = 0;
+    for (int v = 1; v <= val; v++)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            int d = denomination[i];
+            if (d <= v && table[v - d] != INT_MAX && table[v - d] + 1 < table[v])
+            {
+                table[v] = table[v - d] + 1;
+                last[v]  = d;
+            }
+        }
+    }
+
+    if (table[val] == INT_MAX)
+        return result;
+
+    // rekonstruksi komposisi koin
+    result.reserve(table[val]);
+    for (int v = val; v > 0; v -= last[v])
+        result.push_back(last[v]);
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Subset Sum -- Bitset **/
+
+/*
+    Periksa apakah nilai V dapat dibentuk dengan setiap koin dipakai paling banyak satu
+    kali (misal: kumpulan koin fisik di dompet).
+
+    reach merupakan bitset dengan bit ke-v bernilai 1 bila v dapat dibentuk.
+    Menambahkan koin d sama dengan:
+
+        reach = reach | (reach << d)
+
+    Satu operasi shift-or memproses 64 nilai sekaligus, O(n * V / 64).
+*/
+
+bool algorithm(const int coins[], size_t size, int val)
+{
+    size_t words = val / 64 + 1;
+    std::vector<uint64_t> reach(words, 0);
+
+    reach[0] = 1;
+    for (size_t i = 0; i < size; i++)
+    {
+        size_t d     = coins[i];
+        size_t wordd = d / 64, bitd = d % 64;
+
+        if (d == 0 || d > (size_t) val)
+            continue;
+
+        // shift-or dari word tertinggi agar nilai lama tidak tertimpa
+        for (size_t w = words; w-- > wordd; )
+        {
+            uint64_t shifted = reach[w - wordd] << bitd;
+            if (bitd && w > wordd)
+                shifted |= reach[w - wordd - 1] >> (64 - bitd);
+            reach[w] |= shifted;
+        }
+    }
+
+    return (reach[val / 64] >> (val % 64)) & 1;
+}
+
+// ======================================================================================
+
+/** Canonical Coin System -- Greedy or Dynamic Programming **/
+
+/*
+    Kozen & Zaks: jika sistem koin tidak canonical, maka terdapat counterexample
+    terkecil x dengan c[3] + 1 < x < c[n] + c[n - 1] (c terurut menaik).
+    Dengan membandingkan greedy dan DP pada seluruh nilai di rentang tersebut, sistem
+    dapat dipastikan canonical atau tidak. Pemeriksaan ini dilakukan sekali per sistem
+    koin, bukan per penyelesaian. Teorema ini mensyaratkan adanya koin bernilai 1.
+*/
+
+struct coin_system_t
+{
+    std::vector<int> denomination;      // terurut menurun
+    bool canonical;
+
+    coin_system_t(const int arr[], size_t size) : denomination(arr, arr + size)
+    {
+        std::sort(denomination.begin(), denomination.end(), std::greater<int>());
+        canonical = check();
+    }
+
+    // jumlah koin greedy untuk nilai v
+    int greedy_count(int v) const
+    {
+        int count = 0;
+        for (int d : denomination)
+        {
+            count += v / d;
+            v     %= d;
+        }
+        return (v == 0) ? count : INT_MAX;
+    }
+
+    bool check() const
+    {
+        size_t n = denomination.size();
+
+        // tanpa koin bernilai 1, greedy bisa gagal menukar nilai yang sebenarnya bisa
+        if (n == 0 || denomination[n - 1] != 1)
+            return false;
+        if (n < 3)
+            return true;
+
+        // batas pencarian counterexample
+        int high = denomination[0] + denomination[1];
+        std::vector<int> table(high, INT_MAX);
+
+        table[0] = 0;
+        for (int v = 1; v < high; v++)
+        {
+            for (int d : denomination)
+                if (d <= v && table[v - d] != INT_MAX)
+                    table[v] = std::min(table[v], table[v - d] + 1);
+
+            if (table[v] < greedy_count(v))
+                return false;
+        }
+
+        return true;
+    }
+};
+
+// Minimum Coins. Lihat di bagian Dynamic Programming di atas
+std::vector<int> minimum_coins(const int denomination[], size_t size, int val);
+
+auto algorithm(const coin_system_t & system, int val)
+{
+    if (! system.canonical)
+        return minimum_coins(system.denomination.data(), system.denomination.size(), val);
+
+    // greedy: satu pembagian untuk setiap denomination
+    std::vector<int> result;
+    for (int d : system.denomination)
+    {
+        result.insert(result.end(), val / d, d);
+        val %= d;
+    }
+
     return result;
 }
\ No newline at end of file
@@ -18,6 +18,9 @@ Run:
 */
 #include <vector>
 #include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
 
 /*
     Setiap pecahan (faction) dapat direpresentasikan sebagai penjumlahan unit fraction.
@@ -112,5 +115,345 @@ auto algorithm(int num, int denum)
     // pembilang bernilai 1, maka sudah merupakan unit fraction.
     result.push_back(denum);
 
+    return result;
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- Big Integer, lazy **/
+
+/*
+    Penyebut pada metode greedy tumbuh secara double exponential (misal 31/311 menghasilkan
+    10 term dengan penyebut terakhir 537 digit), sehingga int overflow setelah beberapa term.
+
+    Untuk pecahan x/y dengan unit = ceil(y/x) dan r = y mod x (r != 0):
+
+        x/y - 1/unit = (x * unit - y) / (y * unit) = (x - r) / (y * unit)
+
+    Pembilang baru selalu lebih kecil dari x, sehingga pembilang cukup disimpan sebagai
+    uint64_t. Hanya penyebut yang memerlukan big integer, dan pembagian yang dibutuhkan
+    hanyalah pembagian big integer dengan bilangan 64-bit.
+
+    Term dihasilkan satu per satu dengan next() sehingga pemanggil dapat berhenti kapan
+    saja (misal setelah k term atau bila penyebut melebihi ukuran tertentu).
+*/
+
+/*
+    bigint_t beserta operasinya, sama seperti bagian Big Integer
+    (mathematic/c++/cases/numbers/big-integer.cpp)
+*/
+struct bigint_t
+{
+    std::vector<uint64_t> limb;
+
+    bigint_t(uint64_t value = 0)
+    {
+        if (value)
+            limb.push_back(value);
+    }
+
+    bool is_zero() const
+    {
+        return limb.empty();
+    }
+};
+
+// buang limb 0 di posisi tertinggi
+void normalize(bigint_t & a)
+{
+    while (! a.limb.empty() && a.limb.back() == 0)
+        a.limb.pop_back();
+}
+
+// a += b * B^offset (B = 2^64)
+void add_shifted(bigint_t & a, const bigint_t & b, size_t offset = 0)
+{
+    if (a.limb.size() < b.limb.size() + offset)
+        a.limb.resize(b.limb.size() + offset, 0);
+
+    uint64_t carry = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 s = (unsigned __int128) a.limb[i + offset] + b.limb[i] + carry;
+        a.limb[i + offset] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+    }
+
+    // rambatkan carry
+    for (i += offset; carry && i < a.limb.size(); i++)
+    {
+        a.limb[i] += carry;
+        carry = (a.limb[i] == 0);
+    }
+
+    if (carry)
+        a.limb.push_back(carry);
+}
+
+bigint_t add(const bigint_t & a, const bigint_t & b)
+{
+    bigint_t result = a;
+    add_shifted(result, b);
+    return result;
+}
+
+// a -= b, dengan syarat a >= b
+void sub_inplace(bigint_t & a, const bigint_t & b)
+{
+    uint64_t borrow = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 d = (unsigned __int128) a.limb[i] - b.limb[i] - borrow;
+        a.limb[i] = (uint64_t) d;
+        borrow = (uint64_t) (d >> 127);
+    }
+
+    for (; borrow && i < a.limb.size(); i++)
+    {
+        borrow = (a.limb[i] == 0);
+        a.limb[i] --;
+    }
+
+    normalize(a);
+}
+
+const size_t KARATSUBA_THRESHOLD = 32;
+
+// out[0 .. na + nb) = a * b, out harus bernilai 0 sebelumnya
+void mul_schoolbook(const uint64_t a[], size_t na, const uint64_t b[], size_t nb,
+    uint64_t out[])
+{
+    for (size_t i = 0; i < na; i++)
+    {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < nb; j++)
+        {
+            unsigned __int128 p = (unsigned __int128) a[i] * b[j] + out[i + j] + carry;
+            out[i + j] = (uint64_t) p;
+            carry = (uint64_t) (p >> 64);
+        }
+        out[i + nb] = carry;
+    }
+}
+
+// bentuk bigint_t dari potongan limb [low, high)
+bigint_t slice(const bigint_t & a, size_t low, size_t high)
+{
+    bigint_t result;
+
+    low  = std::min(low,  a.limb.size());
+    high = std::min(high, a.limb.size());
+    result.limb.assign(a.limb.begin() + low, a.limb.begin() + high);
+    normalize(result);
+
+    return result;
+}
+
+bigint_t mul(const bigint_t & a, const bigint_t & b)
+{
+    size_t na = a.limb.size(), nb = b.limb.size();
+    bigint_t result;
+
+    if (na == 0 || nb == 0)
+        return result;
+
+    // operand kecil: schoolbook
+    if (std::min(na, nb) < KARATSUBA_THRESHOLD)
+    {
+        result.limb.assign(na + nb, 0);
+        if (na >= nb)
+            mul_schoolbook(a.limb.data(), na, b.limb.data(), nb, result.limb.data());
+        else
+            mul_schoolbook(b.limb.data(), nb, a.limb.data(), na, result.limb.data());
+        normalize(result);
+        return result;
+    }
+
+    // operand tidak seimbang: potong operand panjang seukuran operand pendek
+    if (2 * std::min(na, nb) <= std::max(na, nb))
+    {
+        const bigint_t & lng = (na > nb) ? a : b;
+        const bigint_t & sht = (na > nb) ? b : a;
+        size_t step = sht.limb.size();
+
+        for (size_t i = 0; i < lng.limb.size(); i += step)
+            add_shifted(result, mul(slice(lng, i, i + step), sht), i);
+
+        normalize(result);
+        return result;
+    }
+
+    // karatsuba
+    size_t m = std::max(na, nb) / 2;
+
+    bigint_t a0 = slice(a, 0, m), a1 = slice(a, m, na);
+    bigint_t b0 = slice(b, 0, m), b1 = slice(b, m, nb);
+
+    bigint_t z0 = mul(a0, b0);
+    bigint_t z2 = mul(a1, b1);
+    bigint_t z1 = mul(add(a0, a1), add(b0, b1));
+    sub_inplace(z1, z0);
+    sub_inplace(z1, z2);
+
+    result = z0;
+    add_shifted(result, z1, m);
+    add_shifted(result, z2, 2 * m);
+    normalize(result);
+
+    return result;
+}
+
+// a /= d, mengembalikan sisa bagi
+uint64_t div_small(bigint_t & a, uint64_t d)
+{
+    unsigned __int128 rem = 0;
+
+    for (size_t i = a.limb.size(); i-- > 0; )
+    {
+        unsigned __int128 cur = (rem << 64) | a.limb[i];
+        a.limb[i] = (uint64_t) (cur / d);
+        rem = cur % d;
+    }
+
+    normalize(a);
+    return (uint64_t) rem;
+}
+
+// Mencari GCD. Lihat di bagian GCD
+size_t gcd(size_t num_1, size_t num_2);
+
+struct egyptian_greedy_t
+{
+    uint64_t num;
+    bigint_t denum;
+
+    // pecahan harus valid: 0 < num < denum
+    egyptian_greedy_t(uint64_t num, uint64_t denum) : num(num), denum(denum) {}
+
+    // hasilkan penyebut unit fraction berikutnya, false bila sudah habis
+    bool next(bigint_t & unit)
+    {
+        if (num == 0)
+            return false;
+
+        unit = denum;
+        uint64_t r = div_small(unit, num);
+
+        // x/y = 1/(y/x)
+        if (r == 0)
+        {
+            num = 0;
+            return true;
+        }
+
+        add_shifted(unit, bigint_t(1), 0);
+
+        // (y * unit) mod x' dihitung dari sisa bagi masing-masing faktor
+        uint64_t next_num = num - r;
+        bigint_t y = denum, u = unit;
+        unsigned __int128 m = (unsigned __int128) div_small(y, next_num) * div_small(u, next_num);
+        uint64_t g = gcd(next_num, (uint64_t) (m % next_num));
+
+        denum = mul(denum, unit);
+        div_small(denum, g);
+        num = next_num / g;
+
+        return true;
+    }
+};
+
+auto algorithm(uint64_t num, uint64_t denum) -> std::vector<bigint_t>
+{
+    std::vector<bigint_t> result;
+    egyptian_greedy_t gen(num, denum);
+    bigint_t unit;
+
+    while (gen.next(unit))
+        result.push_back(unit);
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Binary Remainder Method **/
+
+/*
+    Penyebut pada metode greedy tidak terbatas. Metode berikut menjamin penyebut kecil
+    dengan jumlah term O(log y).
+
+    Pilih 2^k >= y, lalu bagi x * 2^k dengan y: x * 2^k = q * y + r (q < 2^k, r < y).
+
+        x/y = q / 2^k + r / (y * 2^k)
+
+    q dan r ditulis dalam bentuk biner. Setiap bit i pada q menghasilkan 1 / 2^(k - i)
+    dan setiap bit j pada r menghasilkan 1 / (y * 2^(k - j)). Penyebut tidak lebih dari
+    y * 2^k < 2y^2 dan seluruh term berbeda.
+
+    Syarat: 0 < x < y < 2^31.
+*/
+
+auto algorithm(uint32_t num, uint32_t denum) -> std::vector<uint64_t>
+{
+    std::vector<uint64_t> result;
+    int k = 0;
+
+    while ((1ULL << k) < denum)
+        k++;
+
+    uint64_t q = ((uint64_t) num << k) / denum;
+    uint64_t r = ((uint64_t) num << k) % denum;
+
+    // bit terbesar menghasilkan penyebut terkecil
+    for (int i = k - 1; i >= 0; i--)
+        if ((q >> i) & 1)
+            result.push_back(1ULL << (k - i));
+
+    for (int j = k - 1; j >= 0; j--)
+        if ((r >> j) & 1)
+            result.push_back((uint64_t) denum << (k - j));
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Golomb's Method **/
+
+/*
+    Misal p = x^-1 mod y, maka x * p = 1 + m * y dengan 0 <= m < x. Sehingga
+
+        x/y = (1 + m * y) / (p * y) = 1 / (p * y) + m / p
+
+    Pecahan m/p memiliki pembilang lebih kecil dari x, sehingga proses berakhir dalam
+    paling banyak x langkah. Penyebut selalu < y^2 dan menurun di setiap langkah.
+
+    Syarat: 0 < x < y < 2^32 dan gcd(x, y) = 1.
+*/
+
+// Modular Inverse. Lihat di bagian Modular Arithmetic (mathematic/c++/cases/numbers)
+uint64_t inverse(uint64_t a, uint64_t m);
+
+auto algorithm(uint64_t num, uint64_t denum) -> std::vector<uint64_t>
+{
+    std::vector<uint64_t> result;
+
+    while (num > 1)
+    {
+        uint64_t p = inverse(num, denum);
+        uint64_t m = (num * p - 1) / denum;
+
+        result.push_back(p * denum);
+        num   = m;
+        denum = p;
+    }
+
+    if (num == 1)
+        result.push_back(denum);
+
     return result;
 }
\ No newline at end of file
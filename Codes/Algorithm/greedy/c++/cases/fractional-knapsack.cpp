@@ -17,6 +17,8 @@ Run:
     $ fractional-knapsack
 */
 #include <vector>
+#include <random>
+#include <cstdint>
 #include <algorithm>
 
 /*
@@ -53,9 +55,10 @@ bool compare_weight(item_t a, item_t b)
     return (a.weight < b.weight);
 }
 
+// bandingkan p/w tanpa pembagian bilangan bulat (yang membulatkan ke bawah)
 bool compare_density(item_t a, item_t b)
 {
-    return ((a.profit/a.weight) > (b.profit/b.weight));
+    return ((int64_t) a.profit * b.weight > (int64_t) b.profit * a.weight);
 }
 
 // ======================================================================================
@@ -169,4 +172,188 @@ auto algorithm(item_t arr[], size_t size, double capacity)
 
 
     return result;
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- greedy by density, weighted median (quickselect) **/
+
+/*
+    Greedy by density tidak membutuhkan urutan lengkap. Yang dibutuhkan hanyalah item
+    "kritis" (item yang diambil sebagian): seluruh item dengan density lebih besar
+    diambil utuh, seluruh item dengan density lebih kecil tidak diambil.
+
+    Item kritis dicari seperti quickselect dengan bobot sebagai kunci:
+    - pilih pivot acak, partisi kandidat menjadi density > pivot, = pivot, < pivot
+    - bila total bobot bagian > pivot melebihi kapasitas, item kritis ada di sana
+    - sebaliknya ambil bagian tersebut utuh, lanjutkan ke bagian = pivot dan < pivot
+
+    Setiap iterasi membuang satu bagian dari kandidat sehingga waktu rata-rata O(n),
+    bukan O(n log n) seperti sorting.
+
+    weight dan profit disalin ke array terpisah (SoA) dan partisi dilakukan pada indeks,
+    sehingga setiap pass hanya membaca data yang dibutuhkan.
+*/
+
+auto algorithm(item_t arr[], size_t size, double capacity)
+{
+    std::vector<item_t> result;
+    std::vector<int> weight(size), profit(size);
+    std::vector<uint32_t> idx(size);
+    std::minstd_rand rng(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        weight[i] = arr[i].weight;
+        profit[i] = arr[i].profit;
+        idx[i]    = i;
+    }
+
+    // ambil item utuh atau sebagian (bila sisa kapasitas tidak mencukupi)
+    auto take = [&](uint32_t k)
+    {
+        item_t t = arr[k];
+        t.ratio  = (weight[k] <= capacity) ? 1.0 : capacity / weight[k];
+
+        result.push_back(t);
+        capacity = (t.ratio == 1.0) ? capacity - weight[k] : 0;
+    };
+
+    // kandidat item kritis berada di idx[low .. high)
+    size_t low = 0, high = size;
+    while (low < high && capacity > 0)
+    {
+        uint32_t pv = idx[low + rng() % (high - low)];
+        int64_t  pw = weight[pv], pp = profit[pv];
+
+        // partisi 3 arah: [low, lt) > pivot, [lt, gt) = pivot, [gt, high) < pivot
+        size_t lt = low, gt = high;
+        double heavy = 0;
+        for (size_t i = low; i < gt; )
+        {
+            uint32_t k = idx[i];
+            int64_t  a = profit[k] * pw, b = pp * weight[k];
+
+            if (a > b)
+            {
+                heavy += weight[k];
+                std::swap(idx[i++], idx[lt++]);
+            }
+            else if (a < b)
+                std::swap(idx[i], idx[--gt]);
+            else
+                i++;
+        }
+
+        // item kritis memiliki density lebih besar dari pivot
+        if (heavy > capacity)
+        {
+            high = lt;
+            continue;
+        }
+
+        for (size_t i = low; i < lt; i++)
+            take(idx[i]);
+
+        // density sama: urutan pengambilan tidak mempengaruhi profit
+        for (size_t i = lt; i < gt && capacity > 0; i++)
+            take(idx[i]);
+
+        low = gt;
+    }
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Batch Solution -- satu sorting untuk banyak kapasitas **/
+
+/*
+    Bila item yang sama digunakan untuk banyak kapasitas berbeda, urutan density cukup
+    dihitung sekali. catalog_t menyimpan item terurut berdasarkan density dalam bentuk
+    SoA beserta prefix sum bobot dan profit:
+
+        prefix_weight[k] = weight[0] + ... + weight[k - 1]
+
+    Untuk kapasitas C, k item pertama diambil utuh dengan k terbesar sehingga
+    prefix_weight[k] <= C (binary search), lalu item ke-k diambil sebagian.
+    Setiap kapasitas diselesaikan dalam O(log n).
+*/
+
+struct catalog_t
+{
+    // terurut menurun berdasarkan density
+    std::vector<int> object_id;
+    std::vector<int> weight;
+    std::vector<int> profit;
+
+    std::vector<int64_t> prefix_weight;
+    std::vector<int64_t> prefix_profit;
+
+    catalog_t(const item_t arr[], size_t size)
+    {
+        std::vector<item_t> sorted(arr, arr + size);
+        std::sort(sorted.begin(), sorted.end(), compare_density);
+
+        prefix_weight.assign(size + 1, 0);
+        prefix_profit.assign(size + 1, 0);
+        for (size_t i = 0; i < size; i++)
+        {
+            object_id.push_back(sorted[i].object_id);
+            weight.push_back(sorted[i].weight);
+            profit.push_back(sorted[i].profit);
+
+            prefix_weight[i + 1] = prefix_weight[i] + sorted[i].weight;
+            prefix_profit[i + 1] = prefix_profit[i] + sorted[i].profit;
+        }
+    }
+
+    // jumlah item yang diambil utuh untuk kapasitas tertentu
+    size_t split(double capacity) const
+    {
+        auto it = std::upper_bound(prefix_weight.begin(), prefix_weight.end(), capacity);
+        return (it - prefix_weight.begin()) - 1;
+    }
+
+    double profit_of(double capacity) const
+    {
+        size_t k = split(capacity);
+        double value = prefix_profit[k];
+
+        if (k < weight.size())
+            value += (capacity - prefix_weight[k]) * profit[k] / weight[k];
+
+        return value;
+    }
+};
+
+// komposisi item untuk satu kapasitas
+auto algorithm(const catalog_t & catalog, double capacity)
+{
+    std::vector<item_t> result;
+    size_t k = catalog.split(capacity);
+
+    for (size_t i = 0; i <= k && i < catalog.weight.size(); i++)
+    {
+        item_t t = { catalog.object_id[i], catalog.weight[i], catalog.profit[i], 1.0 };
+
+        if (i == k)
+        {
+            t.ratio = (capacity - catalog.prefix_weight[k]) / t.weight;
+            if (t.ratio <= 0)
+                break;
+        }
+
+        result.push_back(t);
+    }
+
+    return result;
+}
+
+// profit maksimum untuk setiap kapasitas
+void algorithm(const catalog_t & catalog, const double capacity[], double profit[], size_t N)
+{
+    for (size_t i = 0; i < N; i++)
+        profit[i] = catalog.profit_of(capacity[i]);
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ Run:
     $ integer-knapsack
 */
 #include <vector>
+#include <cstdint>
 #include <algorithm>
 
 /*
@@ -57,9 +58,10 @@ bool compare_weight(item_t a, item_t b)
     return (a.weight < b.weight);
 }
 
+// bandingkan p/w tanpa pembagian bilangan bulat (yang membulatkan ke bawah)
 bool compare_density(item_t a, item_t b)
 {
-    return ((a.profit/a.weight) > (b.profit/b.weight));
+    return ((int64_t) a.profit * b.weight > (int64_t) b.profit * a.weight);
 }
 
 // ======================================================================================
@@ -134,5 +136,158 @@ auto algorithm(item_t arr[], size_t size, int capacity)
         }
     }
 
+    return result;
+}
+
+// ======================================================================================
+
+/*
+    Solusi greedy di atas tidak menjamin hasil optimal. Solusi di bawah bersifat eksak.
+*/
+
+// ======================================================================================
+
+/** Dynamic Programming -- 1D Rolling Array **/
+
+/*
+    table[w] = profit maksimum dengan kapasitas w menggunakan item yang telah diproses.
+
+        next[w] = max(table[w], table[w - weight] + profit)
+
+    Dua baris (table dan next) digunakan bergantian, sehingga inner loop tidak memiliki
+    dependensi antar iterasi dan tanpa percabangan: compiler dapat melakukan vektorisasi
+    (misal 8 int per instruksi AVX2 dengan -O3 -mavx2). Waktu O(n * W).
+
+    keep[i] mencatat kapasitas di mana item i dipakai (bit per kapasitas) untuk
+    rekonstruksi komposisi item. Memori O(W) untuk table dan next, ditambah matriks bit
+    keep sebesar O(n * W / 64) word.
+*/
+
+auto algorithm(item_t arr[], size_t size, int capacity)
+{
+    std::vector<item_t> result;
+    std::vector<int> table(capacity + 1, 0), next(capacity + 1);
+    std::vector<std::vector<uint64_t>> keep(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        int wt = arr[i].weight, pf = arr[i].profit;
+        keep[i].assign(capacity / 64 + 1, 0);
+
+        if (wt > capacity)
+            continue;
+
+        // kapasitas lebih kecil dari bobot item: tidak berubah
+        std::copy(table.begin(), table.begin() + wt, next.begin());
+
+        const int * src = table.data();
+        int       * dst = next.data();
+        for (int w = wt; w <= capacity; w++)
+        {
+            int take = src[w - wt] + pf;
+            dst[w] = (take > src[w]) ? take : src[w];
+        }
+
+        for (int w = wt; w <= capacity; w++)
+            if (next[w] != table[w])
+                keep[i][w / 64] |= 1ULL << (w % 64);
+
+        table.swap(next);
+    }
+
+    // rekonstruksi dari item terakhir
+    for (size_t i = size, w = capacity; i-- > 0; )
+    {
+        if ((keep[i][w / 64] >> (w % 64)) & 1)
+        {
+            result.push_back(arr[i]);
+            w -= arr[i].weight;
+        }
+    }
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Branch and Bound -- greedy by density sebagai bound **/
+
+/*
+    Untuk kapasitas besar (n * W terlalu besar untuk DP).
+
+    Item diurutkan berdasarkan density (compare_density). Pada setiap node, batas atas
+    profit dihitung dengan fractional knapsack dari item yang tersisa: item diambil utuh
+    selama muat, lalu sebagian dari item berikutnya. Karena item terurut berdasarkan
+    density, bound ini tidak pernah lebih kecil dari solusi optimal sehingga cabang
+    dengan bound <= profit terbaik dapat dipangkas.
+
+    Pencarian depth-first dengan cabang "ambil" terlebih dahulu, sehingga solusi greedy
+    by density langsung menjadi solusi awal.
+*/
+
+struct bnb_t
+{
+    const item_t * items;
+    size_t size;
+
+    std::vector<bool> take, best_take;
+    int64_t best = -1;
+
+    // fractional bound mulai dari item idx
+    double bound(size_t idx, int64_t room, int64_t profit) const
+    {
+        double value = profit;
+
+        for (; idx < size && items[idx].weight <= room; idx++)
+        {
+            room  -= items[idx].weight;
+            value += items[idx].profit;
+        }
+
+        if (idx < size)
+            value += (double) room * items[idx].profit / items[idx].weight;
+
+        return value;
+    }
+
+    void search(size_t idx, int64_t room, int64_t profit)
+    {
+        if (profit > best)
+        {
+            best      = profit;
+            best_take = take;
+        }
+
+        if (idx == size || bound(idx, room, profit) <= best)
+            return;
+
+        if (items[idx].weight <= room)
+        {
+            take[idx] = true;
+            search(idx + 1, room - items[idx].weight, profit + items[idx].profit);
+            take[idx] = false;
+        }
+
+        search(idx + 1, room, profit);
+    }
+};
+
+auto algorithm(item_t arr[], size_t size, int capacity)
+{
+    std::vector<item_t> result;
+
+    // urutkan item berdasarkan densitas (kepadatan)
+    std::sort(arr, arr + size, compare_density);
+
+    bnb_t bnb;
+    bnb.items = arr;
+    bnb.size  = size;
+    bnb.take.assign(size, false);
+    bnb.search(0, capacity, 0);
+
+    for (size_t i = 0; i < size; i++)
+        if (bnb.best_take[i])
+            result.push_back(arr[i]);
+
     return result;
 }
\ No newline at end of file
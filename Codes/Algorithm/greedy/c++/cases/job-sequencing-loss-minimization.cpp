@@ -16,6 +16,11 @@ Compile:
 Run:
     $ job-sequencing-loss-minimization
 */
+#include <queue>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
 
 /*
 Masalah:
@@ -35,7 +40,9 @@ Langkah:
     - urutkan job berdasarkan potensi kerugian terbesar (jika tertunda).
 */
 #include <vector>
+#include <cstdint>
 #include <utility>
+#include <algorithm>
 
 // ======================================================================================
 
@@ -46,9 +53,10 @@ struct job_t
     int loss;
 };
 
+// loss/time terbesar didahulukan, perkalian 64-bit agar tidak overflow
 bool compare(job_t a, job_t b)
 {
-    return ((a.loss * b.time) > (b.loss * a.time));
+    return ((int64_t) a.loss * b.time > (int64_t) b.loss * a.time);
 }
 
 // ======================================================================================
@@ -66,5 +74,212 @@ auto algorithm(job_t arr[], int size)
     for (size_t i = 0; i < size; i++)
         jobids.push_back(arr[i].job_id);
 
+    return jobids;
+}
+
+// ======================================================================================
+
+/** Event Simulation -- multi server, streaming arrival **/
+
+/*
+    Aturan yang sama (rasio loss/time, Smith's rule) diterapkan pada m server dengan job
+    yang datang secara bertahap. Kerugian job dihitung sebagai loss * waktu selesai.
+*/
+
+/*
+    Pairing heap dan simulator antrean, sama seperti bagian Event Simulation
+    (minimum-queue-time.cpp)
+*/
+template <typename T, typename Compare>
+struct pairing_heap_t
+{
+    struct node_t
+    {
+        T   value;
+        int child;
+        int sibling;
+    };
+
+    std::vector<node_t> pool;
+    std::vector<int>    free_list;
+    std::vector<int>    pairs;          // buffer untuk two-pass pairing
+    int     root  = -1;
+    size_t  count = 0;
+    Compare cmp;
+
+    pairing_heap_t(Compare cmp = Compare()) : cmp(cmp) {}
+
+    bool empty() const          { return root < 0; }
+    size_t size() const         { return count; }
+    const T & top() const       { return pool[root].value; }
+
+    // gabungkan dua root, root dengan prioritas lebih rendah menjadi anak
+    int meld(int a, int b)
+    {
+        if (a < 0) return b;
+        if (b < 0) return a;
+
+        if (cmp(pool[b].value, pool[a].value))
+            std::swap(a, b);
+
+        pool[b].sibling = pool[a].child;
+        pool[a].child   = b;
+        return a;
+    }
+
+    void push(const T & value)
+    {
+        int t;
+
+        if (! free_list.empty())
+        {
+            t = free_list.back();
+            free_list.pop_back();
+            pool[t] = { value, -1, -1 };
+        }
+        else
+        {
+            t = pool.size();
+            pool.push_back({ value, -1, -1 });
+        }
+
+        root = meld(root, t);
+        count ++;
+    }
+
+    void pop()
+    {
+        // pass 1: pasangkan anak dari kiri ke kanan
+        pairs.clear();
+        for (int c = pool[root].child; c >= 0; )
+        {
+            int a = c, b = pool[a].sibling;
+            int next = (b >= 0) ? pool[b].sibling : -1;
+
+            pool[a].sibling = -1;
+            if (b >= 0)
+                pool[b].sibling = -1;
+
+            pairs.push_back(meld(a, b));
+            c = next;
+        }
+
+        // pass 2: gabungkan dari kanan ke kiri
+        int merged = -1;
+        for (size_t i = pairs.size(); i-- > 0; )
+            merged = meld(pairs[i], merged);
+
+        free_list.push_back(root);
+        root = merged;
+        count --;
+    }
+};
+
+template <typename Job, typename Compare>
+struct queue_simulator_t
+{
+    struct entry_t
+    {
+        Job     job;
+        int64_t arrival;
+        int64_t duration;
+    };
+
+    // aturan prioritas, job yang datang lebih awal didahulukan bila setara
+    struct order_t
+    {
+        Compare cmp;
+
+        bool operator()(const entry_t & a, const entry_t & b) const
+        {
+            if (cmp(a.job, b.job)) return true;
+            if (cmp(b.job, a.job)) return false;
+            return a.arrival < b.arrival;
+        }
+    };
+
+    pairing_heap_t<entry_t, order_t> ready;
+    std::priority_queue<int64_t, std::vector<int64_t>, std::greater<int64_t>> server;
+    std::vector<int64_t> waits;
+    std::function<void(const Job &, int64_t, int64_t)> on_dispatch;
+    int64_t clock = 0;
+
+    queue_simulator_t(size_t servers, Compare cmp = Compare()) : ready(order_t { cmp })
+    {
+        for (size_t i = 0; i < servers; i++)
+            server.push(0);
+    }
+
+    // jalankan seluruh dispatch dengan waktu mulai < limit
+    void advance(int64_t limit)
+    {
+        while (! ready.empty() && ! server.empty())
+        {
+            int64_t start = std::max(server.top(), clock);
+            if (start >= limit)
+                break;
+
+            entry_t e = ready.top();
+            ready.pop();
+            server.pop();
+            server.push(start + e.duration);
+
+            waits.push_back(start - e.arrival);
+            if (on_dispatch)
+                on_dispatch(e.job, start, start + e.duration);
+        }
+    }
+
+    // arrival harus tidak lebih kecil dari arrival job sebelumnya
+    void push(const Job & job, int64_t arrival, int64_t duration)
+    {
+        advance(arrival);
+        clock = arrival;
+        ready.push({ job, arrival, duration });
+    }
+
+    // selesaikan seluruh job yang tersisa
+    void finish()
+    {
+        advance(INT64_MAX);
+    }
+
+    double mean_wait() const
+    {
+        double total = 0;
+        for (int64_t w : waits)
+            total += w;
+        return waits.empty() ? 0 : total / waits.size();
+    }
+
+    // persentil waktu tunggu, p dalam rentang [0, 100]
+    int64_t percentile(double p)
+    {
+        if (waits.empty())
+            return 0;
+
+        size_t k = std::min(waits.size() - 1, (size_t) (p / 100 * waits.size()));
+        std::nth_element(waits.begin(), waits.begin() + k, waits.end());
+        return waits[k];
+    }
+};
+
+// arrival[i] merupakan waktu kedatangan job arr[i], terurut menaik
+auto algorithm(job_t arr[], const int64_t arrival[], int size, size_t servers,
+    int64_t & total_loss)
+{
+    std::vector<int> jobids;
+    queue_simulator_t<job_t, bool(*)(job_t, job_t)> sim(servers, compare);
+
+    total_loss = 0;
+    sim.on_dispatch = [&](const job_t & job, int64_t, int64_t finish) {
+        jobids.push_back(job.job_id);
+        total_loss += job.loss * finish;
+    };
+
+    for (int i = 0; i < size; i++)
+        sim.push(arr[i], arrival[i], arr[i].time);
+    sim.finish();
+
     return jobids;
 }
\ No newline at end of file
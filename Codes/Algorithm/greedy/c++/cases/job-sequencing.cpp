@@ -17,7 +17,11 @@ Run:
     $ job-sequencing
 */
 #include <vector>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
 #include <utility>
+#include <algorithm>
 
 /*
 Masalah:
@@ -141,8 +145,8 @@ auto algorithm(job_t arr[], int size)
     int latest_deadline = findMaxDeadline(arr, size);
 
     // alokasi ruang dan buat setiap node merupakan parent dari diri sendiri
-    int parent[size + 1];
-    for (int i = 0; i <= size; i++)
+    int parent[latest_deadline + 1];
+    for (int i = 0; i <= latest_deadline; i++)
         parent[i] = i;
     
     // telusuri semua job
@@ -160,7 +164,7 @@ auto algorithm(job_t arr[], int size)
             Query berikutnya untuk slot kosong akan mengembalikan slot kosong tersedia di 
             (slot - 1)
             */
-            _union(_find(parent, slot - 1), slot);
+            _union(parent, _find(parent, slot - 1), slot);
 
             schedule_t schedule;
             schedule.job_id = arr[i].job_id;
@@ -170,4 +174,256 @@ auto algorithm(job_t arr[], int size)
     }
 
     return schedules;    
+}
+
+// ======================================================================================
+
+/** Disjoint Set -- path halving, union by size **/
+
+/*
+    Versi _find/_union di atas bersifat rekursif dan menggabungkan himpunan tanpa
+    memperhatikan ukuran, sehingga tree dapat memanjang.
+
+    - path halving: setiap node yang dilewati find() diarahkan ke kakeknya. Iteratif,
+      satu pass, dan tetap memberikan kompleksitas amortized O(alpha(n)).
+    - union by size: root himpunan kecil menjadi anak dari root himpunan besar.
+*/
+
+struct disjoint_set_t
+{
+    std::vector<uint32_t> parent;
+    std::vector<uint32_t> size;
+
+    disjoint_set_t(size_t n = 0) : parent(n), size(n, 1)
+    {
+        std::iota(parent.begin(), parent.end(), 0);
+    }
+
+    uint32_t find(uint32_t x)
+    {
+        while (parent[x] != x)
+        {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // gabungkan dua himpunan, mengembalikan root yang baru
+    uint32_t unite(uint32_t a, uint32_t b)
+    {
+        a = find(a);
+        b = find(b);
+
+        if (a == b)
+            return a;
+
+        if (size[a] < size[b])
+            std::swap(a, b);
+
+        parent[b] = a;
+        size[a]  += size[b];
+        return a;
+    }
+};
+
+/*
+    Varian lock-free untuk digunakan oleh banyak thread sekaligus.
+
+    parent disimpan sebagai atomic dan setiap perubahan dilakukan dengan compare-and-swap.
+    Agar tidak terbentuk siklus ketika dua thread menggabungkan himpunan yang sama secara
+    bersamaan, root dengan indeks lebih kecil selalu menjadi anak dari root dengan indeks
+    lebih besar (union by index, bukan by size).
+*/
+
+struct concurrent_disjoint_set_t
+{
+    std::vector<std::atomic<uint32_t>> parent;
+
+    concurrent_disjoint_set_t(size_t n) : parent(n)
+    {
+        for (size_t i = 0; i < n; i++)
+            parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    uint32_t find(uint32_t x)
+    {
+        while (true)
+        {
+            uint32_t p = parent[x].load(std::memory_order_acquire);
+            if (p == x)
+                return x;
+
+            // path halving, gagal CAS tidak masalah karena thread lain telah memperbaiki
+            uint32_t gp = parent[p].load(std::memory_order_acquire);
+            if (p != gp)
+                parent[x].compare_exchange_weak(p, gp, std::memory_order_release,
+                    std::memory_order_relaxed);
+
+            x = gp;
+        }
+    }
+
+    bool same(uint32_t a, uint32_t b)
+    {
+        while (true)
+        {
+            a = find(a);
+            b = find(b);
+
+            if (a == b)
+                return true;
+
+            // a masih root: a dan b memang berbeda himpunan
+            if (parent[a].load(std::memory_order_acquire) == a)
+                return false;
+        }
+    }
+
+    // mengembalikan false bila a dan b sudah berada di himpunan yang sama
+    bool unite(uint32_t a, uint32_t b)
+    {
+        while (true)
+        {
+            a = find(a);
+            b = find(b);
+
+            if (a == b)
+                return false;
+
+            if (a < b)
+                std::swap(a, b);
+
+            // b harus masih root saat dihubungkan ke a
+            uint32_t expected = b;
+            if (parent[b].compare_exchange_strong(expected, a, std::memory_order_acq_rel))
+                return true;
+        }
+    }
+};
+
+// ======================================================================================
+
+/** Incremental Solution -- Disjoint Set dengan kompresi koordinat **/
+
+/*
+    Dua solusi sebelumnya mengalokasikan satu slot untuk setiap unit waktu hingga deadline
+    terbesar. Untuk deadline hingga 1e9 hal ini tidak mungkin.
+
+    Kompresi koordinat: deadline yang berbeda diurutkan menjadi d[1] < d[2] < ... < d[K]
+    (d[0] = 0). Slot waktu dikelompokkan menjadi interval (d[k - 1], d[k]] dengan kapasitas
+    d[k] - d[k - 1]. Disjoint set dibentuk atas interval, bukan slot. Job dengan deadline
+    d[k] mengambil slot terakhir yang kosong pada interval kosong terdekat <= k. Interval
+    yang habis digabungkan dengan interval sebelumnya. Interval 0 merupakan sentinel
+    (tidak ada slot tersisa). Memori O(n) berapapun nilai deadline.
+
+    Scheduler menerima job baru secara online. Job ditampung di pending dan baru diurutkan
+    ketika mencapai ukuran batch (atau ketika hasil diminta), lalu digabung (merge) dengan
+    job yang telah diterima sebelumnya yang sudah terurut. Ukuran batch minimal sebanyak
+    job yang telah diterima sehingga setiap job hanya diproses ulang O(log n) kali.
+
+    Job yang pernah ditolak tidak akan pernah diterima lagi walaupun ada job baru:
+    penambahan job hanya mempersempit slot yang tersedia (sifat matroid). Sehingga hanya
+    job yang diterima yang perlu disimpan.
+*/
+
+struct job_scheduler_t
+{
+    std::vector<job_t> accepted;        // terurut menurun berdasarkan profit
+    std::vector<job_t> pending;
+    std::vector<schedule_t> schedules;
+    size_t batch;
+
+    job_scheduler_t(size_t batch = 1 << 16) : batch(batch) {}
+
+    void add(job_t job)
+    {
+        pending.push_back(job);
+
+        // batch tumbuh mengikuti jumlah job yang diterima: total biaya flush amortized
+        if (pending.size() >= std::max(batch, accepted.size()))
+            flush();
+    }
+
+    void flush()
+    {
+        if (pending.empty())
+            return;
+
+        // hanya job baru yang diurutkan
+        std::vector<job_t> jobs(accepted.size() + pending.size());
+        std::sort(pending.begin(), pending.end(), compare);
+        std::merge(accepted.begin(), accepted.end(), pending.begin(), pending.end(),
+            jobs.begin(), compare);
+        pending.clear();
+
+        // kompresi koordinat deadline
+        std::vector<int> bound(1, 0);
+        for (const auto & job : jobs)
+            if (job.deadline > 0)
+                bound.push_back(job.deadline);
+
+        std::sort(bound.begin() + 1, bound.end());
+        bound.erase(std::unique(bound.begin(), bound.end()), bound.end());
+
+        size_t K = bound.size();
+        std::vector<int> capacity(K, 0);
+        std::vector<uint32_t> free_of(K);
+        disjoint_set_t sets(K);
+
+        for (size_t k = 1; k < K; k++)
+            capacity[k] = bound[k] - bound[k - 1];
+        std::iota(free_of.begin(), free_of.end(), 0);
+
+        accepted.clear();
+        schedules.clear();
+
+        for (const auto & job : jobs)
+        {
+            if (job.deadline <= 0)
+                continue;
+
+            uint32_t k    = std::lower_bound(bound.begin(), bound.end(), job.deadline) - bound.begin();
+            uint32_t root = sets.find(k);
+            uint32_t iv   = free_of[root];
+
+            // tidak ada slot kosong sebelum deadline
+            if (iv == 0)
+                continue;
+
+            schedule_t schedule;
+            schedule.job_id = job.job_id;
+            schedule.slot   = bound[iv - 1] + capacity[iv];
+            schedules.push_back(schedule);
+            accepted.push_back(job);
+
+            // interval habis, gabungkan dengan interval sebelumnya
+            if (--capacity[iv] == 0)
+            {
+                uint32_t prev = free_of[sets.find(iv - 1)];
+                free_of[sets.unite(root, iv - 1)] = prev;
+            }
+        }
+    }
+
+    long long profit()
+    {
+        flush();
+
+        long long total = 0;
+        for (const auto & job : accepted)
+            total += job.profit;
+        return total;
+    }
+};
+
+auto algorithm(job_t arr[], int size)
+{
+    job_scheduler_t scheduler;
+
+    for (int i = 0; i < size; i++)
+        scheduler.add(arr[i]);
+
+    scheduler.flush();
+    return scheduler.schedules;
 }
\ No newline at end of file
@@ -2,20 +2,34 @@
     Archive of Reversing.ID
     Algorithm (Mathematics/Bits)
 */
+#include <cstdint>
 
 // ======================================================================================
 
-/*
-    
-*/
+/** Rata-rata tanpa overflow **/
 
-static inline 
-ulong floor_average(ulong x, ulong y)
+static inline constexpr
+uint64_t floor_average(uint64_t x, uint64_t y)
 // Return floor( (x+y)/2 )
-// Result is correct even if (x+y) wouldn't fit into a ulong
+// Result is correct even if (x+y) wouldn't fit into a uint64_t
 // Use:      x+y == ((x&y)<<1) + (x^y)
 // that is:  sum ==  carries   + sum_without_carries
 {
     return  (x & y) + ((x ^ y) >> 1);
     // return  y + ((x-y)>>1);  // works if x>=y
+}
+
+static inline constexpr
+uint64_t ceil_average(uint64_t x, uint64_t y)
+// Return ceil( (x+y)/2 )
+// Use:      x+y == ((x|y)<<1) - (x^y)
+{
+    return  (x | y) - ((x ^ y) >> 1);
+}
+
+static inline constexpr
+int64_t floor_average_signed(int64_t x, int64_t y)
+// Versi signed: shift kanan aritmetika membulatkan ke arah -inf
+{
+    return  (x & y) + ((x ^ y) >> 1);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
     Archive of Reversing.ID
     Algorithm (Mathematics/Bits)
 */
+#include <cstddef>
 
 // ======================================================================================
 
@@ -9,7 +10,7 @@
 
 // Copy dari posisi [isrc] ke posisi [idst]
 
-static inline 
+static inline constexpr
 size_t copy(size_t bits, size_t isrc, size_t idst)
 {
     size_t x = ((bits >> isrc) ^ (bits >> idst)) & 1;   // bernilai 1 jika bits berbeda
@@ -19,7 +20,7 @@ size_t copy(size_t bits, size_t isrc, size_t idst)
 
 // Copy dengan posisi dikodekan sebagai mask
 
-static inline
+static inline constexpr
 size_t copy(size_t bits, size_t msrc, size_t mdst)
 {
     size_t x = mdst;
@@ -0,0 +1,336 @@
+/*
+    Bit Intrinsics
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Bits)
+
+Compile:
+    [clang]
+    $ clang++ -std=c++14 -O2 -march=native intrinsics.cpp -o intrinsics
+
+    [gcc]
+    $ g++ -std=c++14 -O2 -march=native intrinsics.cpp -o intrinsics
+
+    [msvc]
+    $ cl /std:c++14 /O2 /arch:AVX2 intrinsics.cpp
+
+Run:
+    $ intrinsics
+*/
+#include <cstdint>
+
+#if defined(__BMI2__) || defined(_MSC_VER)
+#include <immintrin.h>
+#endif
+
+/*
+    Operasi bit pada satu word 64-bit. Setiap operasi memiliki dua versi:
+    - versi software (akhiran _soft): portable dan constexpr, dapat dievaluasi saat kompilasi
+    - versi utama: memakai builtin / instruksi hardware bila tersedia, fallback ke versi
+      software bila tidak. Versi utama pdep, pext, dan select tidak constexpr karena
+      instruksi BMI2 tidak dapat dievaluasi saat kompilasi.
+
+    Instruksi hardware yang dipakai:
+    - popcnt             jumlah bit 1
+    - tzcnt / lzcnt      jumlah bit 0 di bawah (ctz) / di atas (clz)
+    - pdep / pext (BMI2) sebar / kumpulkan bit menurut mask
+
+    Catatan: pdep / pext pada AMD sebelum Zen 3 diimplementasikan dengan microcode dan
+    jauh lebih lambat dari versi software untuk mask yang padat. Definisikan
+    BITS_NO_PDEP untuk memaksa versi software.
+*/
+
+// ======================================================================================
+
+/** Population Count **/
+
+// SWAR: jumlahkan bit per 2, per 4, per 8, lalu kumpulkan 8 byte dengan perkalian
+static inline constexpr
+int popcount_soft(uint64_t x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int) ((x * 0x0101010101010101ULL) >> 56);
+}
+
+static inline constexpr
+int popcount(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    return popcount_soft(x);
+#endif
+}
+
+// ======================================================================================
+
+/** Count Trailing / Leading Zeros **/
+
+// posisi bit 1 terendah, 64 bila x = 0
+static inline constexpr
+int ctz_soft(uint64_t x)
+{
+    return x ? popcount_soft((x & (0 - x)) - 1) : 64;
+}
+
+// jumlah bit 0 di atas bit 1 tertinggi, 64 bila x = 0
+static inline constexpr
+int clz_soft(uint64_t x)
+{
+    // sebarkan bit tertinggi ke seluruh bit di bawahnya
+    x |= x >> 1;  x |= x >> 2;  x |= x >> 4;
+    x |= x >> 8;  x |= x >> 16; x |= x >> 32;
+    return 64 - popcount_soft(x);
+}
+
+static inline constexpr
+int ctz(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return x ? __builtin_ctzll(x) : 64;
+#else
+    return ctz_soft(x);
+#endif
+}
+
+static inline constexpr
+int clz(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return x ? __builtin_clzll(x) : 64;
+#else
+    return clz_soft(x);
+#endif
+}
+
+// floor(log2(x)), -1 bila x = 0
+static inline constexpr
+int log2_floor(uint64_t x)
+{
+    return 63 - clz(x);
+}
+
+static inline constexpr
+bool is_power_of_two(uint64_t x)
+{
+    return x && ! (x & (x - 1));
+}
+
+// pangkat dua terkecil >= x (1 bila x = 0), 0 bila melebihi 2^63
+static inline constexpr
+uint64_t bit_ceil(uint64_t x)
+{
+    return (x <= 1) ? 1 : (x > (1ULL << 63)) ? 0 : 1ULL << (64 - clz(x - 1));
+}
+
+// pangkat dua terbesar <= x, 0 bila x = 0
+static inline constexpr
+uint64_t bit_floor(uint64_t x)
+{
+    return x ? 1ULL << log2_floor(x) : 0;
+}
+
+// ======================================================================================
+
+/** Rotasi **/
+
+static inline constexpr
+uint64_t rotl(uint64_t x, int k)
+{
+    return (x << (k & 63)) | (x >> ((64 - k) & 63));
+}
+
+static inline constexpr
+uint64_t rotr(uint64_t x, int k)
+{
+    return (x >> (k & 63)) | (x << ((64 - k) & 63));
+}
+
+// ======================================================================================
+
+/** Bit Reversal **/
+
+static inline constexpr
+uint64_t byte_swap_soft(uint64_t x)
+{
+    x = ((x >> 8)  & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+    x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+    return (x >> 32) | (x << 32);
+}
+
+static inline constexpr
+uint64_t byte_swap(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(x);
+#else
+    return byte_swap_soft(x);
+#endif
+}
+
+// tukar bit, pasangan bit, nibble di dalam byte, lalu balik urutan byte
+static inline constexpr
+uint64_t reverse(uint64_t x)
+{
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return byte_swap(x);
+}
+
+// ======================================================================================
+
+/** Parallel Bit Deposit / Extract **/
+
+/*
+    pdep(x, mask): bit ke-i dari x ditempatkan pada posisi bit 1 ke-i dari mask.
+    pext(x, mask): bit x pada posisi bit 1 dari mask dikumpulkan ke bit terendah.
+
+        x    = .... ..ab          mask = 1010 0100
+        pdep = a.b. .c..  (bit c dari x diletakkan pada bit 1 terendah dari mask)
+
+    Versi software menelusuri bit 1 dari mask satu per satu, O(popcount(mask)).
+*/
+
+static inline constexpr
+uint64_t pdep_soft(uint64_t x, uint64_t mask)
+{
+    uint64_t result = 0;
+
+    for (uint64_t bit = 1; mask; bit <<= 1)
+    {
+        uint64_t low = mask & (0 - mask);       // bit 1 terendah dari mask
+        if (x & bit)
+            result |= low;
+        mask ^= low;
+    }
+
+    return result;
+}
+
+static inline constexpr
+uint64_t pext_soft(uint64_t x, uint64_t mask)
+{
+    uint64_t result = 0;
+
+    for (uint64_t bit = 1; mask; bit <<= 1)
+    {
+        uint64_t low = mask & (0 - mask);
+        if (x & low)
+            result |= bit;
+        mask ^= low;
+    }
+
+    return result;
+}
+
+#if defined(__BMI2__) && ! defined(BITS_NO_PDEP)
+
+static inline
+uint64_t pdep(uint64_t x, uint64_t mask)
+{
+    return _pdep_u64(x, mask);
+}
+
+static inline
+uint64_t pext(uint64_t x, uint64_t mask)
+{
+    return _pext_u64(x, mask);
+}
+
+#else
+
+static inline
+uint64_t pdep(uint64_t x, uint64_t mask)
+{
+    return pdep_soft(x, mask);
+}
+
+static inline
+uint64_t pext(uint64_t x, uint64_t mask)
+{
+    return pext_soft(x, mask);
+}
+
+#endif
+
+// ======================================================================================
+
+/** Rank dan Select **/
+
+/*
+    rank(x, i)   jumlah bit 1 pada posisi [0, i), i di [0, 64]
+    select(x, k) posisi bit 1 ke-k (dimulai dari 0), 64 bila popcount(x) <= k
+
+    Dengan BMI2, select = ctz(pdep(1 << k, x)): pdep menempatkan satu bit tepat pada bit 1
+    ke-k dari x. Tanpa BMI2, dicari byte yang memuat bit tersebut dengan prefix sum
+    popcount per byte (SWAR), lalu bit di dalam byte ditelusuri.
+*/
+
+static inline constexpr
+int rank(uint64_t x, int i)
+{
+    return (i >= 64) ? popcount(x) : popcount(x & ((1ULL << i) - 1));
+}
+
+static inline constexpr
+int select_soft(uint64_t x, int k)
+{
+    if (k >= popcount_soft(x))
+        return 64;
+
+    // popcount per byte
+    uint64_t s = x - ((x >> 1) & 0x5555555555555555ULL);
+    s = (s & 0x3333333333333333ULL) + ((s >> 2) & 0x3333333333333333ULL);
+    s = (s + (s >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    // prefix sum: byte ke-b berisi jumlah bit 1 pada byte 0 .. b
+    uint64_t prefix = s * 0x0101010101010101ULL;
+
+    int byte = 0;
+    while ((int) ((prefix >> (8 * byte)) & 0xFF) <= k)
+        byte++;
+
+    int before = byte ? (int) ((prefix >> (8 * (byte - 1))) & 0xFF) : 0;
+    uint64_t b = (x >> (8 * byte)) & 0xFF;
+
+    for (int r = k - before; r > 0; r--)
+        b &= b - 1;
+
+    return 8 * byte + ctz_soft(b);
+}
+
+#if defined(__BMI2__) && ! defined(BITS_NO_PDEP)
+
+static inline
+int select(uint64_t x, int k)
+{
+    return (k < 64) ? ctz(_pdep_u64(1ULL << k, x)) : 64;
+}
+
+#else
+
+static inline
+int select(uint64_t x, int k)
+{
+    return select_soft(x, k);
+}
+
+#endif
+
+// ======================================================================================
+
+/** Iterasi bit 1 **/
+
+// panggil visit(i) untuk setiap posisi bit 1, dari yang terendah
+template <typename Visit>
+static inline
+void for_each_bit(uint64_t x, Visit visit)
+{
+    while (x)
+    {
+        visit(ctz(x));
+        x &= x - 1;
+    }
+}
\ No newline at end of file
@@ -2,27 +2,28 @@
     Archive of Reversing.ID
     Algorithm (Mathematics/Bits)
 */
+#include <cstddef>
 
 // ======================================================================================
 
 /** Manipulasi bit (set, clear, toggle) secara individual **/
 
-static inline
+static inline constexpr
 size_t set(size_t bits, size_t idx)
 {
-    return (bits | (1UL << idx));
+    return (bits | (size_t(1) << idx));
 }
 
-static inline
+static inline constexpr
 size_t clear(size_t bits, size_t idx)
 {
-    return (bits & ~(1UL << idx));
+    return (bits & ~(size_t(1) << idx));
 }
 
-static inline 
+static inline constexpr
 size_t toggle(size_t bits, size_t idx)
 {
-    return (bits ^ (1UL << idx));
+    return (bits ^ (size_t(1) << idx));
 }
 
 
@@ -34,7 +35,7 @@ size_t toggle(size_t bits, size_t idx)
     Return word dengan hanya bit posisi paling rendah yang set.
     Return 0 jika tidak ada bit yang set.
 */
-static inline 
+static inline constexpr
 size_t isolate_lowest_one(size_t x)
 {
     // if (0 == x) return 0;
@@ -49,7 +50,7 @@ size_t isolate_lowest_one(size_t x)
     Return word dengan hanya bit posisi paling rendah yang clear.
     Return 0 jika semua bit set.
 */
-static inline 
+static inline constexpr
 size_t isolate_lowest_zero(size_t x)
 {
 //    return  (x ^ (x+1)) & ~x;
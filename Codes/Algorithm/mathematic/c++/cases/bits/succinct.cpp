@@ -0,0 +1,608 @@
+/*
+    Succinct Data Structures
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Bits)
+
+Compile:
+    [clang]
+    $ clang++ -std=c++14 -O2 -march=native succinct.cpp -o succinct
+
+    [gcc]
+    $ g++ -std=c++14 -O2 -march=native succinct.cpp -o succinct
+
+Run:
+    $ succinct
+*/
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#if defined(__BMI2__) || defined(_MSC_VER)
+#include <immintrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*
+    Struktur data succinct: ukuran mendekati batas informasi minimum namun tetap
+    mendukung query secara langsung tanpa dekompresi.
+
+    - rank_select_t  bitvector dengan rank dan select dalam waktu (hampir) konstan,
+                     overhead sekitar 3.5% dari ukuran bitvector
+    - elias_fano_t   barisan bilangan tidak turun (sorted ID, posting list, keluaran
+                     sieve) dalam n (2 + log2(u / n)) bit, dengan akses acak dan
+                     successor query
+
+    Serialisasi:
+    Seluruh isi struktur berupa satu buffer uint64_t yang berdiri sendiri (header + array,
+    tanpa pointer). Buffer dapat ditulis ke file apa adanya, lalu di-mmap dan dipakai
+    langsung dengan load() tanpa parsing maupun salinan. Byte order mengikuti mesin
+    (little-endian pada x86 dan ARM).
+*/
+
+// Operasi bit pada satu word, sama seperti bagian Bit Intrinsics (intrinsics.cpp)
+
+// SWAR: jumlahkan bit per 2, per 4, per 8, lalu kumpulkan 8 byte dengan perkalian
+static inline constexpr
+int popcount_soft(uint64_t x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int) ((x * 0x0101010101010101ULL) >> 56);
+}
+
+static inline constexpr
+int popcount(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    return popcount_soft(x);
+#endif
+}
+
+// posisi bit 1 terendah, 64 bila x = 0
+static inline constexpr
+int ctz_soft(uint64_t x)
+{
+    return x ? popcount_soft((x & (0 - x)) - 1) : 64;
+}
+
+// jumlah bit 0 di atas bit 1 tertinggi, 64 bila x = 0
+static inline constexpr
+int clz_soft(uint64_t x)
+{
+    // sebarkan bit tertinggi ke seluruh bit di bawahnya
+    x |= x >> 1;  x |= x >> 2;  x |= x >> 4;
+    x |= x >> 8;  x |= x >> 16; x |= x >> 32;
+    return 64 - popcount_soft(x);
+}
+
+static inline constexpr
+int ctz(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return x ? __builtin_ctzll(x) : 64;
+#else
+    return ctz_soft(x);
+#endif
+}
+
+static inline constexpr
+int clz(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return x ? __builtin_clzll(x) : 64;
+#else
+    return clz_soft(x);
+#endif
+}
+
+// floor(log2(x)), -1 bila x = 0
+static inline constexpr
+int log2_floor(uint64_t x)
+{
+    return 63 - clz(x);
+}
+
+static inline constexpr
+int select_soft(uint64_t x, int k)
+{
+    if (k >= popcount_soft(x))
+        return 64;
+
+    // popcount per byte
+    uint64_t s = x - ((x >> 1) & 0x5555555555555555ULL);
+    s = (s & 0x3333333333333333ULL) + ((s >> 2) & 0x3333333333333333ULL);
+    s = (s + (s >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    // prefix sum: byte ke-b berisi jumlah bit 1 pada byte 0 .. b
+    uint64_t prefix = s * 0x0101010101010101ULL;
+
+    int byte = 0;
+    while ((int) ((prefix >> (8 * byte)) & 0xFF) <= k)
+        byte++;
+
+    int before = byte ? (int) ((prefix >> (8 * (byte - 1))) & 0xFF) : 0;
+    uint64_t b = (x >> (8 * byte)) & 0xFF;
+
+    for (int r = k - before; r > 0; r--)
+        b &= b - 1;
+
+    return 8 * byte + ctz_soft(b);
+}
+
+#if defined(__BMI2__) && ! defined(BITS_NO_PDEP)
+
+static inline
+int select(uint64_t x, int k)
+{
+    return (k < 64) ? ctz(_pdep_u64(1ULL << k, x)) : 64;
+}
+
+#else
+
+static inline
+int select(uint64_t x, int k)
+{
+    return select_soft(x, k);
+}
+
+#endif
+
+// sama seperti testing.cpp
+/*
+    false jika bits[1] bernilai 0
+    true jika sebaliknya
+*/
+static inline constexpr
+bool test(size_t bits, size_t idx)
+{
+    return ((bits & (size_t(1) << idx)) != 0);
+}
+
+// ======================================================================================
+
+/** Rank / Select Bitvector **/
+
+/*
+    rank1(i)    jumlah bit 1 pada posisi [0, i)
+    select1(k)  posisi bit 1 ke-k (dimulai dari 0)
+    rank0 dan select0 untuk bit 0.
+
+    Direktori rank dua tingkat:
+    - superblock setiap 2^16 bit: rank absolut 64-bit            (0.1% overhead)
+    - block setiap 512 bit (8 word): rank relatif terhadap
+      superblock, cukup 16-bit                                  (3.1% overhead)
+
+    rank1(i) = super[i / 2^16] + block[i / 512] + popcount maksimal 8 word.
+
+    Select memakai sampel: setiap SAMPLE bit 1 (dan bit 0) disimpan nomor block yang
+    memuatnya (0.4% overhead). select1(k) melakukan binary search atas direktori block di
+    antara dua sampel, lalu menelusuri maksimal 8 word dan memakai select di dalam word.
+
+    Layout buffer (dalam uint64_t):
+        header[8]   MAGIC, nbits, ones, nwords, nsuper, nblocks, nsample1, nsample0
+        words       bitvector, dipadatkan ke kelipatan 8 word
+        super       nsuper entry
+        block       nblocks entry uint16_t, 4 per uint64_t
+        sample1     nsample1 + 1 entry (sentinel)
+        sample0     nsample0 + 1 entry (sentinel)
+*/
+
+struct rank_select_t
+{
+    static const uint64_t MAGIC  = 0x3130534B4E4152ULL;        // "RANKS01"
+    static const size_t   SUPER  = 1 << 16;
+    static const size_t   BLOCK  = 512;
+    static const size_t   SAMPLE = 1 << 14;
+    static const size_t   HEADER = 8;
+
+    // buffer milik sendiri, atau kosong bila memakai buffer eksternal (mmap)
+    std::vector<uint64_t> storage;
+    const uint64_t *      external = nullptr;
+
+    size_t nbits = 0, ones = 0, nwords = 0, nsuper = 0, nblocks = 0;
+    size_t nsample1 = 0, nsample0 = 0;
+    size_t off_super = 0, off_block = 0, off_sample1 = 0, off_sample0 = 0, total = 0;
+
+    rank_select_t() {}
+
+    rank_select_t(const uint64_t bits[], size_t N)
+    {
+        nbits   = N;
+        nwords  = (N + 63) / 64;
+        nwords  = (nwords + 7) / 8 * 8;
+        nblocks = nwords / 8;
+        nsuper  = (nblocks * BLOCK + SUPER - 1) / SUPER;
+
+        std::vector<uint64_t> word(bits, bits + (N + 63) / 64);
+        word.resize(nwords, 0);
+        if (N & 63)
+            word[(N - 1) / 64] &= (1ULL << (N & 63)) - 1;
+
+        // direktori rank dan sampel select
+        std::vector<uint64_t> super(nsuper);
+        std::vector<uint16_t> block(nblocks);
+        std::vector<uint64_t> sample1, sample0;
+        uint64_t rank = 0;
+
+        for (size_t b = 0; b < nblocks; b++)
+        {
+            if (b % (SUPER / BLOCK) == 0)
+                super[b / (SUPER / BLOCK)] = rank;
+            block[b] = (uint16_t) (rank - super[b / (SUPER / BLOCK)]);
+
+            uint64_t count = 0;
+            for (size_t w = 0; w < 8; w++)
+                count += popcount(word[8 * b + w]);
+
+            uint64_t zeros = b * BLOCK - rank;
+            while (sample1.size() * SAMPLE < rank + count)
+                sample1.push_back(b);
+            while (sample0.size() * SAMPLE < zeros + BLOCK - count)
+                sample0.push_back(b);
+
+            rank += count;
+        }
+
+        ones     = rank;
+        nsample1 = sample1.size();
+        nsample0 = sample0.size();
+        sample1.push_back(nblocks ? nblocks - 1 : 0);
+        sample0.push_back(nblocks ? nblocks - 1 : 0);
+
+        layout();
+
+        storage.assign(total, 0);
+        uint64_t * buf = storage.data();
+
+        uint64_t header[HEADER] = { MAGIC, nbits, ones, nwords, nsuper, nblocks, nsample1, nsample0 };
+        std::copy(header, header + HEADER, buf);
+        std::copy(word.begin(), word.end(), buf + HEADER);
+        std::copy(super.begin(), super.end(), buf + off_super);
+        std::copy(block.begin(), block.end(), (uint16_t *) (buf + off_block));
+        std::copy(sample1.begin(), sample1.end(), buf + off_sample1);
+        std::copy(sample0.begin(), sample0.end(), buf + off_sample0);
+    }
+
+    // hitung offset setiap array dari ukuran di header
+    void layout()
+    {
+        off_super   = HEADER + nwords;
+        off_block   = off_super + nsuper;
+        off_sample1 = off_block + (nblocks + 3) / 4;
+        off_sample0 = off_sample1 + nsample1 + 1;
+        total       = off_sample0 + nsample0 + 1;
+    }
+
+    // pakai buffer hasil serialisasi (misal dari mmap) tanpa salinan
+    bool load(const uint64_t buffer[])
+    {
+        if (buffer[0] != MAGIC)
+            return false;
+
+        storage.clear();
+        external = buffer;
+        nbits    = buffer[1];  ones    = buffer[2];
+        nwords   = buffer[3];  nsuper  = buffer[4];  nblocks = buffer[5];
+        nsample1 = buffer[6];  nsample0 = buffer[7];
+        layout();
+
+        return true;
+    }
+
+    const uint64_t * data() const
+    {
+        return external ? external : storage.data();
+    }
+
+    // ukuran buffer dalam uint64_t
+    size_t size() const
+    {
+        return total;
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    const uint64_t * words() const
+    {
+        return data() + HEADER;
+    }
+
+    bool access(size_t i) const
+    {
+        return test(words()[i >> 6], i & 63);
+    }
+
+    // rank di awal block b
+    size_t block_rank(size_t b) const
+    {
+        const uint16_t * block = (const uint16_t *) (data() + off_block);
+        return data()[off_super + b / (SUPER / BLOCK)] + block[b];
+    }
+
+    size_t rank1(size_t i) const
+    {
+        if (i >= nbits)
+            return ones;
+
+        const uint64_t * word = words();
+        size_t b = i / BLOCK;
+        size_t r = block_rank(b);
+
+        for (size_t w = 8 * b; w < (i >> 6); w++)
+            r += popcount(word[w]);
+
+        if (i & 63)
+            r += popcount(word[i >> 6] & ((1ULL << (i & 63)) - 1));
+
+        return r;
+    }
+
+    size_t rank0(size_t i) const
+    {
+        return std::min(i, nbits) - rank1(i);
+    }
+
+    // posisi bit 1 (one = true) atau bit 0 ke-k, nbits bila tidak ada
+    size_t select(size_t k, bool one) const
+    {
+        if (k >= (one ? ones : nbits - ones))
+            return nbits;
+
+        const uint64_t * sample = data() + (one ? off_sample1 : off_sample0);
+        auto rank_of = [&](size_t b) {
+            return one ? block_rank(b) : b * BLOCK - block_rank(b);
+        };
+
+        // block terakhir dengan rank awal <= k
+        size_t lo = sample[k / SAMPLE], hi = sample[k / SAMPLE + 1];
+        while (lo < hi)
+        {
+            size_t mid = lo + (hi - lo + 1) / 2;
+            if (rank_of(mid) <= k)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+
+        const uint64_t * word = words();
+        size_t rem = k - rank_of(lo);
+
+        for (size_t w = 8 * lo; ; w++)
+        {
+            uint64_t x = one ? word[w] : ~word[w];
+            size_t   c = popcount(x);
+
+            if (rem < c)
+                return 64 * w + ::select(x, (int) rem);
+            rem -= c;
+        }
+    }
+
+    size_t select1(size_t k) const  { return select(k, true); }
+    size_t select0(size_t k) const  { return select(k, false); }
+
+    // posisi bit 1 pertama yang >= i, nbits bila tidak ada
+    size_t next_one(size_t i) const
+    {
+        if (i >= nbits)
+            return nbits;
+
+        const uint64_t * word = words();
+        size_t   at = i >> 6;
+        uint64_t w  = word[at] & (~0ULL << (i & 63));
+
+        while (! w)
+        {
+            if (++at == nwords)
+                return nbits;
+            w = word[at];
+        }
+
+        return std::min(nbits, 64 * at + ctz(w));
+    }
+};
+
+// ======================================================================================
+
+/** Elias-Fano **/
+
+/*
+    Barisan tidak turun x[0] <= x[1] <= ... <= x[n - 1] < u. Setiap elemen dipecah:
+    - low  : l = floor(log2(u / n)) bit terendah, disimpan rapat n * l bit
+    - high : sisa bit atas h = x >> l, disimpan unary pada bitvector: elemen ke-i
+             menyalakan bit pada posisi h + i. Panjang bitvector n + (u >> l) + 1.
+
+    Total sekitar n (2 + l) bit, dibanding 64n bit untuk array uint64_t.
+
+    access(i)     = ((select1(i) - i) << l) | low[i]
+    next_geq(x)   elemen pertama >= x. Bucket h = x >> l dimulai setelah bit 0 ke-(h - 1)
+                  pada high, yaitu select0(h - 1) + 1; elemen sebelum bucket tersebut
+                  berjumlah select0(h - 1) + 1 - h. Dari sana bucket ditelusuri.
+
+    Layout buffer (dalam uint64_t):
+        header[8]   MAGIC, n, universe, l, nlow, 0, 0, 0
+        low         nlow word (+1 word padding)
+        high        buffer rank_select_t
+*/
+
+struct elias_fano_t
+{
+    static const uint64_t MAGIC  = 0x3130464F4E414CULL;        // "LANOF01"
+    static const size_t   HEADER = 8;
+
+    std::vector<uint64_t> storage;
+    const uint64_t *      external = nullptr;
+
+    size_t   n = 0, l = 0, nlow = 0;
+    uint64_t universe = 0;
+    rank_select_t high;
+
+    elias_fano_t() {}
+
+    // arr harus terurut tidak turun
+    elias_fano_t(const uint64_t arr[], size_t N)
+    {
+        n        = N;
+        universe = N ? arr[N - 1] + 1 : 0;
+        l        = (N && universe > N) ? log2_floor(universe / N) : 0;
+        nlow     = (N * l + 63) / 64 + 1;
+
+        storage.assign(HEADER + nlow, 0);
+        uint64_t * low = storage.data() + HEADER;
+        uint64_t header[HEADER] = { MAGIC, n, universe, l, nlow, 0, 0, 0 };
+        std::copy(header, header + HEADER, storage.data());
+
+        size_t hbits = N + (N ? (arr[N - 1] >> l) : 0) + 1;
+        std::vector<uint64_t> hi((hbits + 63) / 64, 0);
+        uint64_t mask = l ? (~0ULL >> (64 - l)) : 0;
+
+        for (size_t i = 0; i < N; i++)
+        {
+            // low bits pada offset i * l
+            uint64_t v = arr[i] & mask;
+            size_t off = i * l;
+            if (l)
+            {
+                low[off >> 6] |= v << (off & 63);
+                if ((off & 63) + l > 64)
+                    low[(off >> 6) + 1] |= v >> (64 - (off & 63));
+            }
+
+            size_t pos = (arr[i] >> l) + i;
+            hi[pos >> 6] |= 1ULL << (pos & 63);
+        }
+
+        high = rank_select_t(hi.data(), hbits);
+    }
+
+    bool load(const uint64_t buffer[])
+    {
+        if (buffer[0] != MAGIC)
+            return false;
+
+        storage.clear();
+        external = buffer;
+        n = buffer[1];  universe = buffer[2];  l = buffer[3];  nlow = buffer[4];
+
+        return high.load(buffer + HEADER + nlow);
+    }
+
+    // buffer berdiri sendiri: header, low, lalu buffer high
+    std::vector<uint64_t> serialize() const
+    {
+        const uint64_t * head = external ? external : storage.data();
+        std::vector<uint64_t> result(head, head + HEADER + nlow);
+
+        result.insert(result.end(), high.data(), high.data() + high.size());
+        return result;
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    uint64_t low(size_t i) const
+    {
+        if (! l)
+            return 0;
+
+        const uint64_t * word = (external ? external : storage.data()) + HEADER;
+        size_t   off = i * l;
+        uint64_t v   = word[off >> 6] >> (off & 63);
+
+        if ((off & 63) + l > 64)
+            v |= word[(off >> 6) + 1] << (64 - (off & 63));
+
+        return v & (~0ULL >> (64 - l));
+    }
+
+    uint64_t access(size_t i) const
+    {
+        return ((uint64_t) (high.select1(i) - i) << l) | low(i);
+    }
+
+    // indeks elemen pertama >= x (n bila tidak ada), nilainya pada value
+    size_t next_geq(uint64_t x, uint64_t & value) const
+    {
+        if (x >= universe)
+            return n;
+
+        uint64_t h   = x >> l;
+        size_t   pos = h ? high.select0(h - 1) + 1 : 0;
+        size_t   i   = pos - h;
+
+        for (; i < n; i++)
+        {
+            pos   = high.next_one(pos);
+            value = ((uint64_t) (pos - i) << l) | low(i);
+            if (value >= x)
+                return i;
+            pos++;
+        }
+
+        return n;
+    }
+
+    // dekode seluruh barisan secara berurutan, tanpa select
+    void decode(uint64_t out[]) const
+    {
+        const uint64_t * word = high.words();
+
+        for (size_t i = 0, at = 0; i < n; at++)
+            for (uint64_t w = word[at]; w && i < n; w &= w - 1, i++)
+                out[i] = ((uint64_t) (64 * at + ctz(w) - i) << l) | low(i);
+    }
+};
+
+// ======================================================================================
+
+/** Serialisasi ke file **/
+
+bool save(const char * path, const uint64_t buffer[], size_t words)
+{
+    FILE * f = fopen(path, "wb");
+    if (! f)
+        return false;
+
+    bool ok = fwrite(buffer, sizeof(uint64_t), words, f) == words;
+    return (fclose(f) == 0) && ok;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// petakan file ke memory (read-only), hasil dapat langsung diberikan ke load()
+const uint64_t * map(const char * path, size_t & words)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+    void * addr = MAP_FAILED;
+
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+        addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (addr == MAP_FAILED)
+        return nullptr;
+
+    words = st.st_size / sizeof(uint64_t);
+    return (const uint64_t *) addr;
+}
+
+void unmap(const uint64_t buffer[], size_t words)
+{
+    munmap((void *) buffer, words * sizeof(uint64_t));
+}
+
+#endif
\ No newline at end of file
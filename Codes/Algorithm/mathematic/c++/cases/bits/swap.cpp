@@ -2,6 +2,7 @@
     Archive of Reversing.ID
     Algorithm (Mathematics/Bits)
 */
+#include <cstddef>
 
 // ======================================================================================
 
@@ -9,7 +10,7 @@
 
 // Tukar bit antara posisi k1 dan k2
 
-static inline 
+static inline constexpr
 size_t swap(size_t bits, size_t k1, size_t k2)
 {
     size_t x = ((bits >> k1) ^ (bits >> k2)) & 1;
@@ -22,8 +23,8 @@ size_t swap(size_t bits, size_t k1, size_t k2)
 
 // Jika kedua bit memiliki nilai berbeda, routine berikut bisa diterapkan
 
-static inline
+static inline constexpr
 size_t swap(size_t bits, size_t k1, size_t k2)
 {
-    return (a ^ ((1UL << k1) ^ (1UL << k2)));
+    return (bits ^ ((size_t(1) << k1) ^ (size_t(1) << k2)));
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
     Archive of Reversing.ID
     Algorithm (Mathematics/Bits)
 */
+#include <cstddef>
 
 // ======================================================================================
 
@@ -9,8 +10,8 @@
     false jika bits[1] bernilai 0
     true jika sebaliknya
 */
-static inline
+static inline constexpr
 bool test(size_t bits, size_t idx)
 {
-    return ((bits & (1UL << idx)) != 0);
+    return ((bits & (size_t(1) << idx)) != 0);
 }
\ No newline at end of file
@@ -16,7 +16,15 @@ Compile:
 Run:
     $ closest-pair
 */
+#include <set>
 #include <cmath>
+#include <queue>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
 
 /*
 Masalah:
@@ -40,23 +48,32 @@ double distance(point_t p1, point_t p2)
     return sqrt(x*x + y*y);
 }
 
+// kuadrat jarak, cukup untuk membandingkan jarak tanpa sqrt
+double distance2(point_t p1, point_t p2)
+{
+    double x = p1.x - p2.x;
+    double y = p1.y - p2.y;
+
+    return x*x + y*y;
+}
+
 // ======================================================================================
 
 /** pendekatan brute-force **/
 
 void algorithm(point_t arr[], size_t N, size_t & idx1, size_t & idx2)
 {
-    double d, dmin = 0;
+    double d, dmin = std::numeric_limits<double>::infinity();
     size_t i, j;
 
     for (i = 0; i < N; i++)
     {
         for (j = i + 1; j < N; j++)
         {
-            // periksa jarak kedua titik dalam 2D
-            d = distance(arr[i], arr[j]);
+            // periksa jarak kedua titik dalam 2D (kuadrat jarak, tanpa sqrt)
+            d = distance2(arr[i], arr[j]);
 
-            if (d < dmin || dmin == 0)
+            if (d < dmin)
             {
                 dmin = d;
                 idx1 = i;
@@ -64,4 +81,342 @@ void algorithm(point_t arr[], size_t N, size_t & idx1, size_t & idx2)
             }
         }
     }
+}
+
+// ======================================================================================
+
+/** pendekatan divide-and-conquer **/
+
+/*
+    Titik diurutkan berdasarkan x sekali di awal, lalu dibagi dua pada median x.
+    Setelah pasangan terdekat d dari kedua bagian diketahui, pasangan yang melintasi garis
+    pembagi hanya mungkin berada di strip |x - mid| < d. Bila strip terurut berdasarkan
+    y, setiap titik cukup dibandingkan dengan paling banyak 7 titik sebelumnya (hanya 8
+    titik dengan jarak >= d yang dapat berada di kotak d x 2d).
+
+    Urutan berdasarkan y diperoleh dengan merge hasil rekursi (seperti merge sort) sehingga
+    tidak ada sorting di setiap level. Total O(n log n).
+
+    Seluruh perbandingan menggunakan kuadrat jarak. Bagian kiri dan kanan pada level atas
+    dikerjakan oleh thread berbeda. Setiap rekursi hanya menyentuh rentang [low, high)
+    dari array dan buffer sehingga tidak ada data yang dibagi antar thread.
+*/
+
+struct indexed_point_t
+{
+    double x, y;
+    size_t idx;
+};
+
+struct closest_t
+{
+    double d2;          // kuadrat jarak
+    size_t idx1, idx2;
+};
+
+const size_t CLOSEST_PARALLEL_CUTOFF = 1 << 16;
+
+void update(closest_t & best, const indexed_point_t & p, const indexed_point_t & q)
+{
+    double dx = p.x - q.x, dy = p.y - q.y, d2 = dx*dx + dy*dy;
+
+    if (d2 < best.d2)
+        best = { d2, std::min(p.idx, q.idx), std::max(p.idx, q.idx) };
+}
+
+// arr[low .. high) terurut berdasarkan x, setelah selesai terurut berdasarkan y
+closest_t closest(indexed_point_t arr[], indexed_point_t buf[], size_t low, size_t high,
+    int depth)
+{
+    closest_t best = { std::numeric_limits<double>::infinity(), 0, 0 };
+    auto by_y = [](const indexed_point_t & a, const indexed_point_t & b) { return a.y < b.y; };
+
+    if (high - low <= 3)
+    {
+        for (size_t i = low; i < high; i++)
+            for (size_t j = i + 1; j < high; j++)
+                update(best, arr[i], arr[j]);
+
+        std::sort(arr + low, arr + high, by_y);
+        return best;
+    }
+
+    size_t mid  = low + (high - low) / 2;
+    double midx = arr[mid].x;
+    closest_t left, right;
+
+    if (depth > 0 && high - low >= CLOSEST_PARALLEL_CUTOFF)
+    {
+        std::thread worker([&] { left = closest(arr, buf, low, mid, depth - 1); });
+        right = closest(arr, buf, mid, high, depth - 1);
+        worker.join();
+    }
+    else
+    {
+        left  = closest(arr, buf, low, mid, depth - 1);
+        right = closest(arr, buf, mid, high, depth - 1);
+    }
+
+    best = (left.d2 <= right.d2) ? left : right;
+
+    // gabungkan kedua bagian yang telah terurut berdasarkan y
+    std::merge(arr + low, arr + mid, arr + mid, arr + high, buf + low, by_y);
+    std::copy(buf + low, buf + high, arr + low);
+
+    // strip disimpan di buf[low .. ) dan sudah terurut berdasarkan y
+    size_t count = low;
+    for (size_t i = low; i < high; i++)
+    {
+        double dx = arr[i].x - midx;
+        if (dx * dx >= best.d2)
+            continue;
+
+        for (size_t k = count; k-- > low && count - k <= 7; )
+        {
+            double dy = arr[i].y - buf[k].y;
+            if (dy * dy >= best.d2)
+                break;
+
+            update(best, arr[i], buf[k]);
+        }
+
+        buf[count++] = arr[i];
+    }
+
+    return best;
+}
+
+void algorithm(point_t arr[], size_t N, size_t & idx1, size_t & idx2, bool parallel)
+{
+    std::vector<indexed_point_t> pts(N), buf(N);
+
+    if (N < 2)
+        return;
+
+    for (size_t i = 0; i < N; i++)
+        pts[i] = { arr[i].x, arr[i].y, i };
+
+    std::sort(pts.begin(), pts.end(),
+        [](const indexed_point_t & a, const indexed_point_t & b) { return a.x < b.x; });
+
+    // kedalaman rekursi yang dipecah menjadi thread
+    int depth = 0;
+    if (parallel)
+        for (unsigned t = std::max(1u, std::thread::hardware_concurrency()); t > 1; t >>= 1)
+            depth ++;
+
+    closest_t best = closest(pts.data(), buf.data(), 0, N, depth);
+    idx1 = best.idx1;
+    idx2 = best.idx2;
+}
+
+// ======================================================================================
+
+/** k pasangan terdekat -- sweep line **/
+
+/*
+    Titik diproses dari kiri ke kanan berdasarkan x. Max-heap menyimpan k pasangan terbaik
+    sementara, dengan d merupakan jarak pasangan ke-k (tak hingga bila belum terisi k).
+
+    Titik aktif (berjarak x < d dari titik saat ini) disimpan dalam set terurut berdasarkan
+    y. Untuk titik baru, hanya titik aktif dengan |y - y'| < d yang diperiksa. Titik yang
+    tertinggal lebih dari d pada sumbu x dibuang dari set.
+
+    Hasil berupa k pasangan indeks terurut dari jarak terdekat.
+*/
+
+auto algorithm(point_t arr[], size_t N, size_t k)
+{
+    std::vector<closest_t> result;
+    std::vector<size_t> order(N);
+    std::priority_queue<closest_t, std::vector<closest_t>, bool(*)(const closest_t &, const closest_t &)>
+        heap([](const closest_t & a, const closest_t & b) { return a.d2 < b.d2; });
+    std::set<std::pair<double, size_t>> active;
+
+    if (k == 0)
+        return result;
+
+    for (size_t i = 0; i < N; i++)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return arr[a].x < arr[b].x; });
+
+    auto bound = [&]() {
+        return (heap.size() < k) ? std::numeric_limits<double>::infinity() : heap.top().d2;
+    };
+
+    for (size_t i = 0, tail = 0; i < N; i++)
+    {
+        const point_t & p = arr[order[i]];
+
+        // buang titik yang terlalu jauh pada sumbu x
+        for (; tail < i; tail++)
+        {
+            double dx = p.x - arr[order[tail]].x;
+            if (dx * dx < bound())
+                break;
+            active.erase({ arr[order[tail]].y, order[tail] });
+        }
+
+        double d = std::sqrt(bound());
+        for (auto it = active.lower_bound({ p.y - d, 0 }); it != active.end(); ++it)
+        {
+            double dy = it->first - p.y;
+            if (dy * dy >= bound())
+            {
+                if (dy > 0)
+                    break;
+                continue;
+            }
+
+            double d2 = distance2(p, arr[it->second]);
+            if (d2 < bound())
+            {
+                heap.push({ d2, std::min(order[i], it->second), std::max(order[i], it->second) });
+                if (heap.size() > k)
+                    heap.pop();
+            }
+        }
+
+        active.insert({ p.y, order[i] });
+    }
+
+    for (; ! heap.empty(); heap.pop())
+        result.push_back(heap.top());
+    std::reverse(result.begin(), result.end());
+
+    return result;
+}
+
+// ======================================================================================
+
+/** 3 dimensi -- randomized incremental grid **/
+
+/*
+    Rabin / Khuller-Matias: titik dimasukkan dalam urutan acak ke dalam grid dengan ukuran
+    cell d (jarak terdekat sementara). Pasangan dengan jarak < d hanya mungkin berada di
+    27 cell tetangga. Bila ditemukan pasangan lebih dekat, grid dibangun ulang dengan d
+    yang baru. Dengan urutan acak, titik ke-i memperbaiki d dengan peluang O(1/i) sehingga
+    total biaya rebuild sebanding dengan n. Ekspektasi O(n), tanpa sorting.
+
+    Grid berupa hash table open addressing (linear probing) dengan koordinat cell sebagai
+    key, key dan head berada dalam satu slot agar satu probe cukup satu cache line. Titik
+    dalam satu cell dirangkai melalui next[] sehingga tidak ada alokasi per cell. Slot dianggap kosong bila stamp berbeda dengan generasi grid saat ini, sehingga
+    rebuild tidak perlu mengosongkan table.
+*/
+
+struct point3_t
+{
+    double x;
+    double y;
+    double z;
+};
+
+double distance2(point3_t p1, point3_t p2)
+{
+    double x = p1.x - p2.x;
+    double y = p1.y - p2.y;
+    double z = p1.z - p2.z;
+
+    return x*x + y*y + z*z;
+}
+
+void algorithm(point3_t arr[], size_t N, size_t & idx1, size_t & idx2)
+{
+    if (N < 2)
+        return;
+
+    std::vector<size_t> order(N);
+    for (size_t i = 0; i < N; i++)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937_64(N));
+
+    // hash table dengan kapasitas 2^k >= 2N
+    size_t cap = 1;
+    while (cap < 2 * N)
+        cap <<= 1;
+
+    struct slot_t
+    {
+        uint64_t key;
+        size_t   head;
+        uint32_t stamp;
+    };
+
+    const size_t NIL = SIZE_MAX;
+    std::vector<slot_t> table(cap, slot_t { 0, NIL, 0 });
+    std::vector<size_t> next(N);
+    uint32_t gen = 0;
+
+    double best = distance2(arr[order[0]], arr[order[1]]), cell = std::sqrt(best);
+    idx1 = std::min(order[0], order[1]);
+    idx2 = std::max(order[0], order[1]);
+
+    auto coord = [&](double v) { return (int64_t) std::floor(v / cell); };
+    auto key   = [](int64_t cx, int64_t cy, int64_t cz) {
+        return (uint64_t) cx * 0x9E3779B97F4A7C15ULL ^ (uint64_t) cy * 0xC2B2AE3D27D4EB4FULL
+             ^ (uint64_t) cz * 0x165667B19E3779F9ULL;
+    };
+
+    // slot untuk key, berupa slot kosong bila key belum ada
+    auto probe = [&](uint64_t k) {
+        size_t s = (k ^ (k >> 29)) & (cap - 1);
+        while (table[s].stamp == gen && table[s].key != k)
+            s = (s + 1) & (cap - 1);
+        return s;
+    };
+
+    auto insert = [&](size_t i) {
+        uint64_t k = key(coord(arr[i].x), coord(arr[i].y), coord(arr[i].z));
+        size_t   s = probe(k);
+
+        if (table[s].stamp != gen)
+            table[s] = { k, NIL, gen };
+
+        next[i] = table[s].head;
+        table[s].head = i;
+    };
+
+    // bangun grid dari titik order[0 .. count)
+    auto rebuild = [&](size_t count) {
+        gen ++;
+        for (size_t i = 0; i < count; i++)
+            insert(order[i]);
+    };
+
+    rebuild(2);
+    for (size_t n = 2; n < N && best > 0; n++)
+    {
+        const point3_t & p = arr[order[n]];
+        int64_t cx = coord(p.x), cy = coord(p.y), cz = coord(p.z);
+        bool improved = false;
+
+        for (int64_t dx = -1; dx <= 1; dx++)
+        for (int64_t dy = -1; dy <= 1; dy++)
+        for (int64_t dz = -1; dz <= 1; dz++)
+        {
+            size_t s = probe(key(cx + dx, cy + dy, cz + dz));
+            if (table[s].stamp != gen)
+                continue;
+
+            for (size_t j = table[s].head; j != NIL; j = next[j])
+            {
+                double d2 = distance2(p, arr[j]);
+                if (d2 < best)
+                {
+                    best = d2;
+                    idx1 = std::min(order[n], j);
+                    idx2 = std::max(order[n], j);
+                    improved = true;
+                }
+            }
+        }
+
+        if (improved && best > 0)
+        {
+            cell = std::sqrt(best);
+            rebuild(n + 1);
+        }
+        else
+            insert(order[n]);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,493 @@
+/*
+    Convex Hull
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Geometry)
+
+Compile:
+    [clang]
+    $ clang++ -std=c++14 -O2 -mavx2 -pthread convex-hull.cpp -o convex-hull
+
+    [gcc]
+    $ g++ -std=c++14 -O2 -mavx2 -pthread convex-hull.cpp -o convex-hull
+
+    [msvc]
+    $ cl /std:c++14 /O2 /arch:AVX2 convex-hull.cpp
+
+Run:
+    $ convex-hull
+*/
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/*
+Masalah:
+    Diberikan n buah titik. Tentukan convex hull, yaitu poligon convex terkecil yang
+    memuat seluruh titik.
+
+    Hull dikembalikan sebagai daftar vertex dengan urutan counter-clockwise, dimulai dari
+    titik paling kiri (paling bawah bila sama). Titik yang colinear di sisi hull tidak
+    termasuk vertex. Seluruh keputusan belok kiri / kanan menggunakan orient2d yang eksak
+    sehingga hasil tidak rusak oleh titik yang hampir colinear.
+
+    - Monotone Chain (Andrew)  sort lalu bangun lower dan upper hull, O(n log n)
+    - Akl-Toussaint            buang titik di dalam octagon 8 titik ekstrem sebelum hull
+                               dihitung. Untuk titik acak hampir seluruh titik terbuang.
+    - QuickHull paralel        rekursi titik terjauh, subproblem besar dikerjakan oleh
+                               thread berbeda
+
+    Operasi poligon: luas (shoelace) dan point-in-polygon.
+*/
+
+// ======================================================================================
+
+struct point_t
+{
+    double x;
+    double y;
+};
+
+// Orientasi eksak. Lihat di bagian Robust Orientation (line-line-intersection.cpp)
+// > 0 bila p, q, r counter-clockwise, < 0 bila clockwise, 0 bila colinear
+double orient2d(point_t p, point_t q, point_t r);
+
+bool operator<(point_t a, point_t b)
+{
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+bool operator==(point_t a, point_t b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+// ======================================================================================
+
+/** Monotone Chain **/
+
+/*
+    Titik diurutkan menurut (x, y). Lower hull dibangun dari kiri ke kanan, upper hull
+    dari kanan ke kiri. Setiap titik baru membuang vertex terakhir selama tiga vertex
+    terakhir tidak membentuk belokan kiri (counter-clockwise).
+*/
+
+std::vector<point_t> monotone_chain(std::vector<point_t> pts)
+{
+    std::sort(pts.begin(), pts.end());
+    pts.erase(std::unique(pts.begin(), pts.end()), pts.end());
+
+    size_t n = pts.size();
+    if (n < 3)
+        return pts;
+
+    std::vector<point_t> hull(2 * n);
+    size_t k = 0;
+
+    // lower hull
+    for (size_t i = 0; i < n; i++)
+    {
+        while (k >= 2 && orient2d(hull[k - 2], hull[k - 1], pts[i]) <= 0)
+            k--;
+        hull[k++] = pts[i];
+    }
+
+    // upper hull
+    for (size_t i = n - 1, t = k + 1; i-- > 0; )
+    {
+        while (k >= t && orient2d(hull[k - 2], hull[k - 1], pts[i]) <= 0)
+            k--;
+        hull[k++] = pts[i];
+    }
+
+    // titik pertama muncul lagi di akhir
+    hull.resize(k - 1);
+    return hull;
+}
+
+std::vector<point_t> algorithm(const point_t arr[], size_t N)
+{
+    return monotone_chain(std::vector<point_t>(arr, arr + N));
+}
+
+// ======================================================================================
+
+/** Akl-Toussaint Heuristic **/
+
+/*
+    8 titik ekstrem (minimum / maksimum dari x, y, x + y, x - y) merupakan titik di hull
+    dan membentuk octagon convex. Titik yang berada tegas di dalam octagon tidak mungkin
+    menjadi vertex hull sehingga dapat dibuang.
+
+    Uji "di dalam" memakai determinan floating point dengan error bound yang sama seperti
+    orient2d: titik hanya dibuang bila tanda determinan terhadap seluruh sisi pasti
+    positif. Titik yang meragukan tetap disimpan, keputusan akhir diambil oleh hull eksak.
+    Dengan AVX2, 4 titik diuji terhadap 8 sisi sekaligus.
+
+    Pencarian titik ekstrem dan penyaringan dibagi ke banyak thread.
+*/
+
+const double HULL_ERRBOUND = 3.3306690738754716e-16;
+
+// urutan counter-clockwise: kiri, kiri-bawah, bawah, kanan-bawah, kanan, kanan-atas, atas, kiri-atas
+double extreme_key(point_t p, int dir)
+{
+    switch (dir)
+    {
+        case 0:  return - p.x;
+        case 1:  return - p.x - p.y;
+        case 2:  return - p.y;
+        case 3:  return   p.x - p.y;
+        case 4:  return   p.x;
+        case 5:  return   p.x + p.y;
+        case 6:  return   p.y;
+        default: return - p.x + p.y;
+    }
+}
+
+// jalankan job(t, begin, end) untuk setiap potongan [0, N)
+template <typename Job>
+void split_work(size_t N, Job job)
+{
+    size_t nthreads = (N >= (1 << 20)) ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+    size_t chunk    = (N + nthreads - 1) / nthreads;
+
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < nthreads; t++)
+        workers.emplace_back(job, t, std::min(N, t * chunk), std::min(N, (t + 1) * chunk));
+    job(size_t(0), size_t(0), std::min(N, chunk));
+
+    for (auto & w : workers)
+        w.join();
+}
+
+// sisa titik yang mungkin merupakan vertex hull
+std::vector<point_t> akl_toussaint(const point_t arr[], size_t N)
+{
+    if (N < 16)
+        return std::vector<point_t>(arr, arr + N);
+
+    size_t nthreads = (N >= (1 << 20)) ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+    std::vector<std::vector<size_t>> best(nthreads, std::vector<size_t>(8, 0));
+
+    split_work(N, [&](size_t t, size_t begin, size_t end) {
+        if (begin >= end)
+            return;
+        std::vector<size_t> & b = best[t];
+        double key[8];
+
+        for (int d = 0; d < 8; d++)
+        {
+            b[d]   = begin;
+            key[d] = extreme_key(arr[begin], d);
+        }
+
+        for (size_t i = begin + 1; i < end; i++)
+            for (int d = 0; d < 8; d++)
+            {
+                double k = extreme_key(arr[i], d);
+                if (k > key[d])
+                {
+                    key[d] = k;
+                    b[d]   = i;
+                }
+            }
+    });
+
+    // octagon, buang vertex yang berulang
+    std::vector<point_t> oct;
+    for (int d = 0; d < 8; d++)
+    {
+        size_t at = best[0][d];
+        for (size_t t = 1; t < nthreads; t++)
+            if (extreme_key(arr[best[t][d]], d) > extreme_key(arr[at], d))
+                at = best[t][d];
+
+        if (oct.empty() || ! (oct.back() == arr[at]))
+            oct.push_back(arr[at]);
+    }
+    while (oct.size() > 1 && oct.back() == oct.front())
+        oct.pop_back();
+
+    if (oct.size() < 3)
+        return std::vector<point_t>(arr, arr + N);
+
+    // sisi octagon: titik awal (ax, ay) dan arah (dx, dy), dilengkapi dengan sisi kosong
+    double ax[8], ay[8], dx[8], dy[8];
+    for (size_t e = 0; e < 8; e++)
+    {
+        point_t a = oct[std::min(e, oct.size() - 1)];
+        point_t b = oct[(std::min(e, oct.size() - 1) + 1) % oct.size()];
+        ax[e] = a.x;  dx[e] = b.x - a.x;
+        ay[e] = a.y;  dy[e] = b.y - a.y;
+    }
+
+    std::vector<std::vector<point_t>> keep(nthreads);
+
+    split_work(N, [&](size_t t, size_t begin, size_t end) {
+        std::vector<point_t> & out = keep[t];
+        size_t i = begin;
+
+#ifdef __AVX2__
+        const __m256d bound  = _mm256_set1_pd(HULL_ERRBOUND);
+        const __m256d nosign = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+        const int lane[4] = { 0, 2, 1, 3 };
+
+        for (; i + 4 <= end; i += 4)
+        {
+            // point_t berupa AoS: unpack menghasilkan x dan y dengan urutan titik 0, 2, 1, 3
+            __m256d lo = _mm256_loadu_pd(&arr[i].x), hi = _mm256_loadu_pd(&arr[i + 2].x);
+            __m256d px = _mm256_unpacklo_pd(lo, hi);
+            __m256d py = _mm256_unpackhi_pd(lo, hi);
+            __m256d inside = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+            for (int e = 0; e < 8; e++)
+            {
+                __m256d l = _mm256_mul_pd(_mm256_set1_pd(dx[e]), _mm256_sub_pd(py, _mm256_set1_pd(ay[e])));
+                __m256d r = _mm256_mul_pd(_mm256_set1_pd(dy[e]), _mm256_sub_pd(px, _mm256_set1_pd(ax[e])));
+                __m256d err = _mm256_mul_pd(bound, _mm256_add_pd(_mm256_and_pd(l, nosign), _mm256_and_pd(r, nosign)));
+                inside = _mm256_and_pd(inside, _mm256_cmp_pd(_mm256_sub_pd(l, r), err, _CMP_GT_OQ));
+            }
+
+            int mask = _mm256_movemask_pd(inside);
+            if (mask == 0xF)
+                continue;
+            for (int k = 0; k < 4; k++)
+                if (! ((mask >> k) & 1))
+                    out.push_back(arr[i + lane[k]]);
+        }
+#endif
+
+        for (; i < end; i++)
+        {
+            bool inside = true;
+            for (int e = 0; e < 8 && inside; e++)
+            {
+                double l = dx[e] * (arr[i].y - ay[e]);
+                double r = dy[e] * (arr[i].x - ax[e]);
+                inside = (l - r) > HULL_ERRBOUND * (std::fabs(l) + std::fabs(r));
+            }
+
+            if (! inside)
+                out.push_back(arr[i]);
+        }
+    });
+
+    std::vector<point_t> result;
+    for (auto & k : keep)
+        result.insert(result.end(), k.begin(), k.end());
+
+    return result;
+}
+
+// ======================================================================================
+
+/** QuickHull paralel **/
+
+/*
+    Diberikan segmen berarah a -> b dan titik-titik yang tegas berada di kanannya:
+    - c = titik terjauh dari garis ab, pasti vertex hull
+    - titik di dalam segitiga a, c, b dibuang
+    - rekursi untuk titik di kanan a -> c dan titik di kanan c -> b
+
+    Dengan a titik paling kiri dan b titik paling kanan, kanan dari a -> b adalah lower
+    hull dan kanan dari b -> a adalah upper hull, sehingga urutan hasil counter-clockwise.
+
+    Pemilihan titik terjauh memakai determinan floating point. Bila dua titik hampir sama
+    jauhnya, titik yang terpilih dapat saja bukan vertex, sehingga hasil QuickHull
+    (sedikit titik) dibersihkan kembali dengan monotone chain yang eksak.
+*/
+
+void quickhull(const std::vector<point_t> & pts, point_t a, point_t b, int depth, int spawn,
+    std::vector<point_t> & out)
+{
+    if (pts.empty())
+        return;
+
+    double  far = 0;
+    point_t c   = pts[0];
+    for (const point_t & p : pts)
+    {
+        double d = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+        if (d < far)
+        {
+            far = d;
+            c   = p;
+        }
+    }
+
+    std::vector<point_t> left, right;
+    for (const point_t & p : pts)
+    {
+        if (orient2d(a, c, p) < 0)
+            left.push_back(p);
+        else if (orient2d(c, b, p) < 0)
+            right.push_back(p);
+    }
+
+    std::vector<point_t> tail;
+    if (depth < spawn && left.size() + right.size() > (1 << 14))
+    {
+        std::thread worker([&] { quickhull(right, c, b, depth + 1, spawn, tail); });
+        quickhull(left, a, c, depth + 1, spawn, out);
+        worker.join();
+    }
+    else
+    {
+        quickhull(left, a, c, depth + 1, spawn, out);
+        quickhull(right, c, b, depth + 1, spawn, tail);
+    }
+
+    out.push_back(c);
+    out.insert(out.end(), tail.begin(), tail.end());
+}
+
+std::vector<point_t> algorithm(const point_t arr[], size_t N, bool parallel)
+{
+    std::vector<point_t> pts = akl_toussaint(arr, N);
+
+    if (! parallel || pts.size() < 3)
+        return monotone_chain(pts);
+
+    point_t a = *std::min_element(pts.begin(), pts.end());
+    point_t b = *std::max_element(pts.begin(), pts.end());
+
+    std::vector<point_t> lower, upper;
+    for (const point_t & p : pts)
+    {
+        double o = orient2d(a, b, p);
+        if (o < 0)
+            lower.push_back(p);
+        else if (o > 0)
+            upper.push_back(p);
+    }
+
+    int spawn = 0;
+    while ((1u << spawn) < std::max(1u, std::thread::hardware_concurrency()))
+        spawn++;
+
+    std::vector<point_t> low_hull, up_hull;
+    std::thread worker([&] { quickhull(upper, b, a, 1, spawn, up_hull); });
+    quickhull(lower, a, b, 1, spawn, low_hull);
+    worker.join();
+
+    std::vector<point_t> candidates;
+    candidates.push_back(a);
+    candidates.insert(candidates.end(), low_hull.begin(), low_hull.end());
+    candidates.push_back(b);
+    candidates.insert(candidates.end(), up_hull.begin(), up_hull.end());
+
+    return monotone_chain(candidates);
+}
+
+// ======================================================================================
+
+/** Luas Poligon **/
+
+/*
+    Shoelace formula. Luas bertanda: positif bila vertex counter-clockwise. Koordinat
+    digeser relatif terhadap vertex pertama agar perkalian tidak kehilangan presisi untuk
+    poligon kecil yang jauh dari origin.
+*/
+
+double area(const std::vector<point_t> & poly)
+{
+    size_t n = poly.size();
+    if (n < 3)
+        return 0;
+
+    double sum = 0;
+    point_t o = poly[0];
+
+    for (size_t i = 1; i + 1 < n; i++)
+        sum += (poly[i].x - o.x) * (poly[i + 1].y - o.y) - (poly[i + 1].x - o.x) * (poly[i].y - o.y);
+
+    return sum / 2;
+}
+
+// ======================================================================================
+
+/** Point in Polygon **/
+
+/*
+    Poligon sederhana sembarang (tidak harus convex), dengan winding number:
+    setiap sisi yang memotong garis horizontal melalui p ke atas (dengan p di kirinya)
+    menambah 1, ke bawah (dengan p di kanannya) mengurangi 1.
+
+    hasil:
+        1  -> p di dalam poligon
+        0  -> p tepat di sisi poligon
+        -1 -> p di luar poligon
+*/
+
+int contains(const std::vector<point_t> & poly, point_t p)
+{
+    size_t n = poly.size();
+    int winding = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        point_t a = poly[i], b = poly[(i + 1) % n];
+        double  o = orient2d(a, b, p);
+
+        // p di sisi a -> b
+        if (o == 0 && std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+            std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y))
+            return 0;
+
+        if (a.y <= p.y)
+        {
+            if (b.y > p.y && o > 0)
+                winding++;
+        }
+        else if (b.y <= p.y && o < 0)
+            winding--;
+    }
+
+    return winding ? 1 : -1;
+}
+
+/*
+    Poligon convex counter-clockwise (misal hasil convex hull) dalam O(log n): binary
+    search pada kipas segitiga (poly[0], poly[i], poly[i + 1]).
+*/
+
+int contains_convex(const std::vector<point_t> & poly, point_t p)
+{
+    size_t n = poly.size();
+    if (n < 3)
+        return -1;
+
+    point_t o = poly[0];
+
+    // di luar sudut yang dibentuk poly[1] dan poly[n - 1]
+    double first = orient2d(o, poly[1], p), last = orient2d(o, poly[n - 1], p);
+    if (first < 0 || last > 0)
+        return -1;
+
+    // cari segitiga kipas: orient2d(o, poly[lo], p) >= 0 dan orient2d(o, poly[lo + 1], p) < 0
+    size_t lo = 1, hi = n - 1;
+    while (hi - lo > 1)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (orient2d(o, poly[mid], p) >= 0)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    double side = orient2d(poly[lo], poly[lo + 1], p);
+    if (side < 0)
+        return -1;
+
+    // di sisi luar poligon: sisi poly[lo] -> poly[lo + 1], atau sisi pertama / terakhir
+    if (side == 0 || (lo == 1 && first == 0) || (lo + 1 == n - 1 && last == 0))
+        return 0;
+
+    return 1;
+}
\ No newline at end of file
@@ -5,19 +5,32 @@
     
 Compile:
     [clang]
-    $ clang++ line-line-intersection.cpp -o line-line-intersection
+    $ clang++ -std=c++14 -O2 -mavx2 -pthread line-line-intersection.cpp -o line-line-intersection
 
     [gcc]
-    $ g++ line-line-intersection.cpp -o line-line-intersection
+    $ g++ -std=c++14 -O2 -mavx2 -pthread line-line-intersection.cpp -o line-line-intersection
 
     [msvc]
-    $ cl line-line-intersection.cpp
+    $ cl /std:c++14 /O2 /arch:AVX2 line-line-intersection.cpp
 
 Run:
     $ line-line-intersection
 */
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <set>
 #include <cmath>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <utility>
 #include <algorithm>
+#include <unordered_set>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 /*
     Perpotongan (intersection) dari dua buah garis
@@ -35,6 +48,90 @@ struct line_t
 {
     point_t p1;
     point_t p2;
+};
+
+// ======================================================================================
+
+/** Robust Orientation **/
+
+/*
+    Tanda dari determinan
+
+        det = (q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x)
+
+    menentukan orientasi tiga titik. Perhitungan double biasa dapat menghasilkan tanda
+    yang salah bila det sangat kecil dibandingkan operand (titik hampir colinear).
+
+    Filter: selama |det| melebihi batas error perhitungan floating point (Shewchuk),
+    tanda det pasti benar. Hanya kasus yang meragukan (jarang) dihitung secara eksak.
+
+    Perhitungan eksak: det diuraikan menjadi 6 perkalian koordinat. Setiap perkalian a * b
+    direpresentasikan eksak sebagai dua double (fma menghasilkan sisa pembulatan), lalu
+    seluruh suku dijumlahkan sebagai expansion (jumlah double yang tidak saling overlap)
+    tanpa kehilangan presisi. Tanda expansion adalah tanda komponen terbesarnya.
+*/
+
+// x + y = a + b secara eksak
+void two_sum(double a, double b, double & x, double & y)
+{
+    x = a + b;
+    double bv = x - a, av = x - bv;
+    y = (a - av) + (b - bv);
+}
+
+// h = e + b secara eksak, mengembalikan panjang h (m + 1)
+int grow_expansion(const double e[], int m, double b, double h[])
+{
+    double q = b;
+
+    for (int i = 0; i < m; i++)
+        two_sum(q, e[i], q, h[i]);
+    h[m] = q;
+
+    return m + 1;
+}
+
+double orient2d_exact(point_t p, point_t q, point_t r)
+{
+    // det = qx*ry - qx*py - px*ry - qy*rx + qy*px + py*rx
+    const double terms[6][2] = {
+        {  q.x, r.y }, { -q.x, p.y }, { -p.x, r.y },
+        { -q.y, r.x }, {  q.y, p.x }, {  p.y, r.x },
+    };
+
+    double e[13], h[13];
+    int m = 0;
+
+    for (auto & t : terms)
+    {
+        double prod = t[0] * t[1];
+        double err  = std::fma(t[0], t[1], -prod);
+
+        m = grow_expansion(e, m, err, h);
+        std::copy(h, h + m, e);
+        m = grow_expansion(e, m, prod, h);
+        std::copy(h, h + m, e);
+    }
+
+    for (int i = m; i-- > 0; )
+        if (e[i] != 0)
+            return e[i];
+
+    return 0;
+}
+
+// > 0 bila p, q, r counter-clockwise, < 0 bila clockwise, 0 bila colinear
+double orient2d(point_t p, point_t q, point_t r)
+{
+    double left  = (q.x - p.x) * (r.y - p.y);
+    double right = (q.y - p.y) * (r.x - p.x);
+    double det   = left - right;
+
+    const double ERRBOUND = 3.3306690738754716e-16;
+    if (std::fabs(det) > ERRBOUND * (std::fabs(left) + std::fabs(right)))
+        return det;
+
+    return orient2d_exact(p, q, r);
 }
 
 // diberikan tiga titik colinear p, q, r; periksa jika q berada di segmen pr
@@ -55,8 +152,8 @@ bool on_segment(point_t p, point_t q, point_t r)
 */
 int orientation(point_t p, point_t q, point_t r)
 {
-    int val =   (q.y - p.y) * (r.x - q.x) -
-                (q.x - p.x) * (r.y - q.y);
+    // val berupa double dengan tanda yang eksak, bukan int yang terpotong
+    double val = - orient2d(p, q, r);
     
     if (val > 0)
         return 1;
@@ -81,7 +178,7 @@ bool algorithm(line_t line1, line_t line2)
     int o4 = orientation(p2, q2, q1);
 
     // kasus umum
-    if (o1 != o2 && o2 != o4)
+    if (o1 != o2 && o3 != o4)
         return true;
     
     // -- kasus spesial --
@@ -99,4 +196,495 @@ bool algorithm(line_t line1, line_t line2)
   
     // tidak memenuhi kasus apapun
     return false;
+}
+
+// ======================================================================================
+
+/** Sweep Line -- Bentley-Ottmann **/
+
+/*
+    Mencari seluruh pasangan segmen yang berpotongan dari n segmen dalam O((n + k) log n),
+    bukan O(n^2) seperti memeriksa seluruh pasangan.
+
+    Sebuah garis vertikal (sweep line) bergerak dari kiri ke kanan. Status berisi segmen
+    yang dipotong oleh sweep line, terurut dari bawah ke atas (std::set, balanced tree).
+    Dua segmen hanya dapat berpotongan bila pernah bertetangga di status, sehingga setiap
+    perubahan status cukup memeriksa pasangan tetangga yang baru.
+
+    Event diurutkan berdasarkan (x, y) di dalam std::map:
+    - titik ujung kiri      : segmen dimasukkan ke status
+    - titik ujung kanan     : segmen dikeluarkan dari status
+    - titik potong          : dua segmen bertetangga bertukar posisi
+
+    Kasus degenerate ditangani seperti de Berg et al.: pada setiap event point p, seluruh
+    segmen yang melalui p (dimulai, berakhir, atau melintasi p) saling berpotongan di p
+    dan membentuk blok berurutan di status. Segmen vertikal diperlakukan seperti segmen
+    dengan kemiringan tak hingga (sweep line dianggap sedikit miring).
+
+    Seluruh keputusan (urutan status, uji perpotongan, anggota blok) menggunakan orient2d
+    yang robust. Hanya koordinat titik potong, yang dipakai untuk menjadwalkan event,
+    dihitung dengan double biasa.
+*/
+
+struct sweep_t
+{
+    struct node_t
+    {
+        mutable uint32_t seg;       // dapat ditukar tanpa mengubah struktur tree
+    };
+
+    struct event_t
+    {
+        std::vector<uint32_t> start;
+        std::vector<std::pair<uint32_t, uint32_t>> cross;
+    };
+
+    struct order_t
+    {
+        using is_transparent = void;
+        const sweep_t * sw;
+
+        // hanya dipanggil saat memasukkan segmen yang dimulai di p
+        bool operator()(const node_t & a, const node_t & b) const
+        {
+            if (a.seg == b.seg)
+                return false;
+
+            bool a_new = equal(sw->seg[a.seg].p1, sw->p);
+            bool b_new = equal(sw->seg[b.seg].p1, sw->p);
+
+            if (a_new && ! b_new)
+            {
+                double o = sw->side(b.seg);
+                return (o != 0) ? (o < 0) : sw->after(a.seg, b.seg);
+            }
+            if (b_new && ! a_new)
+            {
+                double o = sw->side(a.seg);
+                return (o != 0) ? (o > 0) : sw->after(a.seg, b.seg);
+            }
+            return sw->after(a.seg, b.seg);
+        }
+
+        // segmen berada di bawah p
+        bool operator()(const node_t & a, const point_t &) const { return sw->side(a.seg) > 0; }
+        bool operator()(const point_t &, const node_t & b) const { return sw->side(b.seg) < 0; }
+    };
+
+    using status_t = std::set<node_t, order_t>;
+
+    std::vector<line_t> seg;        // p1 merupakan ujung kiri (x, y leksikografis)
+    std::vector<status_t::iterator> where;
+    std::vector<bool> active;
+
+    std::map<std::pair<double, double>, event_t> events;
+    std::unordered_set<uint64_t> reported, crossed;
+    std::vector<std::pair<size_t, size_t>> result;
+    point_t p;                      // event point saat ini
+
+    static bool equal(point_t a, point_t b)
+    {
+        return a.x == b.x && a.y == b.y;
+    }
+
+    // posisi p relatif terhadap segmen aktif t: > 0 di atas, < 0 di bawah, 0 pada t
+    double side(uint32_t t) const
+    {
+        if (seg[t].p1.x == seg[t].p2.x)
+            return 0;
+        return orient2d(seg[t].p1, seg[t].p2, p);
+    }
+
+    // urutan dua segmen yang melalui p, sesaat setelah p
+    bool after(uint32_t a, uint32_t b) const
+    {
+        double o = orient2d(p, seg[a].p2, seg[b].p2);
+        if (o != 0)
+            return o > 0;
+        return a < b;
+    }
+
+    status_t status;
+
+    sweep_t(const line_t arr[], size_t N) : status(order_t { this })
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            line_t l = arr[i];
+            if (std::make_pair(l.p2.x, l.p2.y) < std::make_pair(l.p1.x, l.p1.y))
+                std::swap(l.p1, l.p2);
+
+            seg.push_back(l);
+            events[{ l.p1.x, l.p1.y }].start.push_back(i);
+            events[{ l.p2.x, l.p2.y }];
+        }
+
+        where.resize(N);
+        active.assign(N, false);
+    }
+
+    static uint64_t key(uint32_t a, uint32_t b)
+    {
+        return ((uint64_t) std::min(a, b) << 32) | std::max(a, b);
+    }
+
+    void report(uint32_t a, uint32_t b)
+    {
+        if (reported.insert(key(a, b)).second)
+            result.push_back({ std::min(a, b), std::max(a, b) });
+    }
+
+    // a tepat di bawah b pada status
+    void check(uint32_t a, uint32_t b)
+    {
+        const line_t & s = seg[a], & t = seg[b];
+        double o1 = orient2d(s.p1, s.p2, t.p1), o2 = orient2d(s.p1, s.p2, t.p2);
+        double o3 = orient2d(t.p1, t.p2, s.p1), o4 = orient2d(t.p1, t.p2, s.p2);
+
+        // hanya perpotongan sejati (bukan menyentuh) yang mengubah urutan status
+        bool proper = o1 != 0 && o2 != 0 && o3 != 0 && o4 != 0 &&
+                      (o1 > 0) != (o2 > 0) && (o3 > 0) != (o4 > 0);
+
+        if (! proper)
+        {
+            if (algorithm(s, t))
+                report(a, b);
+            return;
+        }
+
+        report(a, b);
+        if (crossed.count(key(a, b)))
+            return;
+
+        // titik potong, dijadwalkan tidak lebih awal dari event saat ini
+        double dx1 = s.p2.x - s.p1.x, dy1 = s.p2.y - s.p1.y;
+        double dx2 = t.p2.x - t.p1.x, dy2 = t.p2.y - t.p1.y;
+        double u   = ((t.p1.x - s.p1.x) * dy2 - (t.p1.y - s.p1.y) * dx2) / (dx1 * dy2 - dy1 * dx2);
+
+        std::pair<double, double> q = { s.p1.x + u * dx1, s.p1.y + u * dy1 };
+        if (dx1 == 0) q.first = s.p1.x;
+        if (dx2 == 0) q.first = t.p1.x;
+        q = std::max(q, std::make_pair(p.x, p.y));
+
+        events[q].cross.push_back({ a, b });
+    }
+
+    // periksa tetangga bawah dan atas dari rentang status [first, last]
+    void check_range(status_t::iterator first, status_t::iterator last)
+    {
+        if (first != status.begin())
+            check(std::prev(first)->seg, first->seg);
+
+        auto next = std::next(last);
+        if (next != status.end())
+            check(last->seg, next->seg);
+    }
+
+    void process(event_t & ev)
+    {
+        // titik potong: tukar dua segmen yang bertetangga
+        for (auto & c : ev.cross)
+        {
+            uint32_t a = c.first, b = c.second;
+            if (! active[a] || ! active[b] || crossed.count(key(a, b)))
+                continue;
+            if (std::next(where[a]) != where[b])
+                continue;
+
+            crossed.insert(key(a, b));
+            where[a]->seg = b;
+            where[b]->seg = a;
+            std::swap(where[a], where[b]);
+            check_range(where[b], where[a]);
+        }
+
+        // blok segmen yang melalui p
+        std::vector<uint32_t> block;
+        auto first = status.lower_bound(p);
+        for (auto it = first; it != status.end() && side(it->seg) == 0; ++it)
+            block.push_back(it->seg);
+
+        // seluruh segmen di blok dan yang dimulai di p berpotongan di p
+        for (size_t i = 0; i < block.size(); i++)
+        {
+            for (size_t j = i + 1; j < block.size(); j++)
+                report(block[i], block[j]);
+            for (uint32_t s : ev.start)
+                report(block[i], s);
+        }
+        for (size_t i = 0; i < ev.start.size(); i++)
+            for (size_t j = i + 1; j < ev.start.size(); j++)
+                report(ev.start[i], ev.start[j]);
+
+        // keluarkan segmen yang berakhir di p
+        std::vector<uint32_t> through;
+        for (uint32_t s : block)
+        {
+            if (equal(seg[s].p2, p))
+            {
+                status.erase(where[s]);
+                active[s] = false;
+            }
+            else
+                through.push_back(s);
+        }
+
+        // segmen yang melintasi p: urutan setelah p berkebalikan, tulis ulang di tempat
+        if (! through.empty())
+        {
+            std::vector<status_t::iterator> slots;
+            for (uint32_t s : through)
+                slots.push_back(where[s]);
+
+            std::sort(through.begin(), through.end(),
+                [this](uint32_t a, uint32_t b) { return after(a, b); });
+
+            for (size_t i = 0; i < through.size(); i++)
+            {
+                slots[i]->seg = through[i];
+                where[through[i]] = slots[i];
+                for (size_t j = i + 1; j < through.size(); j++)
+                    crossed.insert(key(through[i], through[j]));
+            }
+        }
+
+        // segmen dengan panjang 0 hanya berupa titik p, tidak perlu masuk status
+        for (uint32_t s : ev.start)
+        {
+            if (equal(seg[s].p1, seg[s].p2))
+                continue;
+
+            where[s]  = status.insert(node_t { s }).first;
+            active[s] = true;
+        }
+
+        // periksa tetangga baru
+        auto lo = status.lower_bound(p);
+        auto hi = lo;
+        if (lo == status.end() || side(lo->seg) != 0)
+        {
+            // tidak ada segmen yang melalui p: tetangga bawah dan atas kini bertemu
+            if (lo != status.end() && lo != status.begin())
+                check(std::prev(lo)->seg, lo->seg);
+            return;
+        }
+
+        while (std::next(hi) != status.end() && side(std::next(hi)->seg) == 0)
+            ++hi;
+        check_range(lo, hi);
+    }
+
+    std::vector<std::pair<size_t, size_t>> run()
+    {
+        while (! events.empty())
+        {
+            auto it = events.begin();
+            p = { it->first.first, it->first.second };
+
+            event_t ev = std::move(it->second);
+            events.erase(it);
+            process(ev);
+        }
+
+        return result;
+    }
+};
+
+auto algorithm(const line_t arr[], size_t N) -> std::vector<std::pair<size_t, size_t>>
+{
+    sweep_t sweep(arr, N);
+    return sweep.run();
+}
+
+// ======================================================================================
+
+/** Sweep Line -- partisi strip paralel **/
+
+/*
+    Bidang dibagi menjadi T strip vertikal dengan jumlah segmen yang seimbang (berdasarkan
+    kuantil x ujung kiri). Setiap strip menjalankan sweep line secara independen atas
+    segmen yang menyentuh strip tersebut.
+
+    Sebuah pasangan dapat ditemukan oleh beberapa strip. Pasangan hanya dilaporkan oleh
+    strip yang memuat max(x ujung kiri kedua segmen), yaitu x terkecil di mana kedua
+    segmen sama-sama ada. Aturan ini hanya membandingkan koordinat input sehingga eksak.
+
+    Efektif bila segmen relatif pendek dibandingkan lebar strip (misal jaringan jalan).
+*/
+
+auto algorithm(const line_t arr[], size_t N, bool parallel) -> std::vector<std::pair<size_t, size_t>>
+{
+    size_t T = parallel ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+    if (T == 1 || N < 2 * T)
+        return algorithm(arr, N);
+
+    auto left  = [&](size_t i) { return std::min(arr[i].p1.x, arr[i].p2.x); };
+    auto right = [&](size_t i) { return std::max(arr[i].p1.x, arr[i].p2.x); };
+
+    // batas strip: strip k = [bound[k], bound[k + 1])
+    std::vector<double> xs(N);
+    for (size_t i = 0; i < N; i++)
+        xs[i] = left(i);
+    std::sort(xs.begin(), xs.end());
+
+    std::vector<double> bound;
+    for (size_t k = 1; k < T; k++)
+        bound.push_back(xs[k * N / T]);
+
+    auto strip_of = [&](double x) {
+        return (size_t) (std::upper_bound(bound.begin(), bound.end(), x) - bound.begin());
+    };
+
+    std::vector<std::vector<size_t>> member(T);
+    for (size_t i = 0; i < N; i++)
+        for (size_t k = strip_of(left(i)); k <= strip_of(right(i)); k++)
+            member[k].push_back(i);
+
+    std::vector<std::vector<std::pair<size_t, size_t>>> found(T);
+    std::vector<std::thread> workers;
+
+    for (size_t k = 0; k < T; k++)
+    {
+        workers.emplace_back([&, k] {
+            std::vector<line_t> lines;
+            for (size_t i : member[k])
+                lines.push_back(arr[i]);
+
+            for (auto & pr : algorithm(lines.data(), lines.size()))
+            {
+                size_t a = member[k][pr.first], b = member[k][pr.second];
+                if (strip_of(std::max(left(a), left(b))) == k)
+                    found[k].push_back({ std::min(a, b), std::max(a, b) });
+            }
+        });
+    }
+
+    std::vector<std::pair<size_t, size_t>> result;
+    for (size_t k = 0; k < T; k++)
+    {
+        workers[k].join();
+        result.insert(result.end(), found[k].begin(), found[k].end());
+    }
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Batch Orientation -- Structure of Arrays **/
+
+/*
+    Orientasi untuk jutaan triplet (p[i], q[i], r[i]) sekaligus. Titik disimpan sebagai
+    SoA sehingga determinan 4 triplet dihitung dengan satu rangkaian instruksi AVX2.
+    Filter error bound yang sama dengan orient2d() diterapkan per lane; hanya lane yang
+    meragukan (hampir colinear) yang dihitung ulang dengan orient2d_exact().
+
+    Hasil mengikuti orientation(): 1 clockwise, -1 counter-clockwise, 0 colinear.
+*/
+
+struct points_t
+{
+    std::vector<double> x;
+    std::vector<double> y;
+};
+
+// Pembagian kerja ke banyak thread, sama seperti bagian Batch (colinear-points.cpp)
+struct throughput_t
+{
+    size_t points;
+    double seconds;
+
+    double rate() const
+    {
+        return (seconds > 0) ? points / seconds : 0;
+    }
+};
+
+const size_t BATCH_CHUNK    = 1 << 16;
+const size_t BATCH_PARALLEL = 1 << 20;
+
+// jalankan kernel(begin, end) atas [0, N), paralel bila N cukup besar
+template <typename Kernel>
+throughput_t parallel_batch(size_t N, Kernel kernel)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    size_t nthreads = (N >= BATCH_PARALLEL) ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+
+    if (nthreads == 1)
+        kernel(size_t(0), N);
+    else
+    {
+        std::atomic<size_t> next(0);
+        std::vector<std::thread> workers;
+
+        for (size_t t = 0; t < nthreads; t++)
+        {
+            workers.emplace_back([&] {
+                size_t begin;
+                while ((begin = next.fetch_add(BATCH_CHUNK)) < N)
+                    kernel(begin, std::min(N, begin + BATCH_CHUNK));
+            });
+        }
+
+        for (auto & w : workers)
+            w.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+    return { N, elapsed.count() };
+}
+
+void orientation(const points_t & p, const points_t & q, const points_t & r, int8_t out[],
+    size_t begin, size_t end)
+{
+    const double * px = p.x.data(), * py = p.y.data();
+    const double * qx = q.x.data(), * qy = q.y.data();
+    const double * rx = r.x.data(), * ry = r.y.data();
+
+    const double ERRBOUND = 3.3306690738754716e-16;
+    size_t i = begin;
+
+#ifdef __AVX2__
+    const __m256d bound  = _mm256_set1_pd(ERRBOUND);
+    const __m256d nosign = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+
+    for (; i + 4 <= end; i += 4)
+    {
+        __m256d ax = _mm256_loadu_pd(px + i), ay = _mm256_loadu_pd(py + i);
+        __m256d left  = _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(qx + i), ax),
+                                      _mm256_sub_pd(_mm256_loadu_pd(ry + i), ay));
+        __m256d right = _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(qy + i), ay),
+                                      _mm256_sub_pd(_mm256_loadu_pd(rx + i), ax));
+        __m256d det   = _mm256_sub_pd(left, right);
+        __m256d err   = _mm256_mul_pd(bound,
+                            _mm256_add_pd(_mm256_and_pd(left, nosign), _mm256_and_pd(right, nosign)));
+
+        int ccw = _mm256_movemask_pd(_mm256_cmp_pd(det, err, _CMP_GT_OQ));
+        int cw  = _mm256_movemask_pd(_mm256_cmp_pd(det, _mm256_sub_pd(_mm256_setzero_pd(), err), _CMP_LT_OQ));
+
+        for (int k = 0; k < 4; k++)
+        {
+            if ((ccw >> k) & 1)
+                out[i + k] = -1;
+            else if ((cw >> k) & 1)
+                out[i + k] = 1;
+            else
+            {
+                double val = orient2d_exact({ px[i + k], py[i + k] }, { qx[i + k], qy[i + k] },
+                                            { rx[i + k], ry[i + k] });
+                out[i + k] = (val > 0) ? -1 : (val < 0) ? 1 : 0;
+            }
+        }
+    }
+#endif
+
+    for (; i < end; i++)
+        out[i] = orientation({ px[i], py[i] }, { qx[i], qy[i] }, { rx[i], ry[i] });
+}
+
+throughput_t algorithm(const points_t & p, const points_t & q, const points_t & r, int8_t out[])
+{
+    return parallel_batch(p.x.size(), [&](size_t begin, size_t end) {
+        orientation(p, q, r, out, begin, end);
+    });
 }
\ No newline at end of file
@@ -0,0 +1,767 @@
+/*
+    Spatial Index
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Geometry)
+
+Compile:
+    [clang]
+    $ clang++ -std=c++14 -O2 -pthread spatial-index.cpp -o spatial-index
+
+    [gcc]
+    $ g++ -std=c++14 -O2 -pthread spatial-index.cpp -o spatial-index
+
+    [msvc]
+    $ cl /std:c++14 /O2 spatial-index.cpp
+
+Run:
+    $ spatial-index
+*/
+#include <cmath>
+#include <queue>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+/*
+Masalah:
+    Diberikan n buah titik. Jawab banyak pertanyaan kedekatan secara cepat:
+    - nearest neighbour / k-nearest neighbour dari sebuah titik query
+    - seluruh titik dalam radius r dari titik query
+    - seluruh titik dalam sebuah kotak (box) [lo, hi]
+
+    Tanpa struktur data, setiap query membutuhkan scan O(n) terhadap seluruh titik.
+
+    Dua macam index:
+    - kd_tree_t  k-d tree implisit. Titik disusun ulang sehingga median setiap rentang
+                 berada di tengah rentang, tidak ada pointer child. Rentang kecil (leaf)
+                 di-scan secara linear.
+    - grid_t     uniform grid. Titik dikelompokkan per cell dengan counting sort (layout
+                 CSR) sehingga titik dalam satu cell bersebelahan di memory. Cocok untuk
+                 titik yang tersebar merata dan radius query yang kecil.
+
+    Kedua index dapat dibangun secara paralel. Query batch dijalankan oleh banyak thread,
+    query diurutkan dengan Morton order terlebih dahulu agar query yang berdekatan
+    mengunjungi bagian index yang sama (cache tetap hangat).
+
+    Seluruh query mengembalikan indeks titik pada array asal.
+*/
+
+// ======================================================================================
+
+struct point_t
+{
+    double x;
+    double y;
+};
+
+// kuadrat jarak, cukup untuk membandingkan jarak tanpa sqrt
+double distance2(point_t p1, point_t p2)
+{
+    double x = p1.x - p2.x;
+    double y = p1.y - p2.y;
+
+    return x*x + y*y;
+}
+
+// koordinat ke-dim (0 = x, 1 = y)
+inline double coord(point_t p, int dim)
+{
+    return dim ? p.y : p.x;
+}
+
+// max-heap (jarak kuadrat, indeks) berisi k kandidat terbaik
+using candidates_t = std::priority_queue<std::pair<double, size_t>>;
+
+void offer(candidates_t & heap, size_t k, double d2, size_t idx)
+{
+    if (heap.size() < k)
+        heap.emplace(d2, idx);
+    else if (d2 < heap.top().first)
+    {
+        heap.pop();
+        heap.emplace(d2, idx);
+    }
+}
+
+// kosongkan heap menjadi daftar indeks, terurut dari yang terdekat
+std::vector<size_t> drain(candidates_t & heap)
+{
+    std::vector<size_t> result(heap.size());
+
+    for (size_t i = result.size(); i-- > 0; heap.pop())
+        result[i] = heap.top().second;
+
+    return result;
+}
+
+// ======================================================================================
+
+/** k-d Tree (implisit) **/
+
+/*
+    Rentang [lo, hi) pada kedalaman depth:
+    - bila hi - lo <= LEAF, rentang merupakan leaf
+    - selain itu, titik di mid = (lo + hi) / 2 merupakan median pada sumbu depth % 2,
+      anak kiri [lo, mid) dan anak kanan [mid + 1, hi)
+
+    Struktur pohon seluruhnya ditentukan oleh lo dan hi sehingga tidak ada pointer yang
+    perlu disimpan. Koordinat (pts) dan indeks asal (id) disimpan terpisah: traversal
+    hanya menyentuh pts, id hanya dibaca ketika titik masuk ke hasil.
+*/
+
+struct kd_tree_t
+{
+    static const size_t LEAF = 8;
+
+    std::vector<point_t> pts;
+    std::vector<size_t>  id;
+
+    kd_tree_t(const point_t arr[], size_t N, bool parallel = true)
+    {
+        std::vector<std::pair<point_t, size_t>> nodes(N);
+        for (size_t i = 0; i < N; i++)
+            nodes[i] = { arr[i], i };
+
+        // thread baru di level atas hingga jumlah subtree >= jumlah core
+        int spawn = 0;
+        if (parallel)
+            while ((1u << spawn) < std::max(1u, std::thread::hardware_concurrency()))
+                spawn++;
+
+        build(nodes, 0, N, 0, spawn);
+
+        pts.resize(N);
+        id.resize(N);
+        for (size_t i = 0; i < N; i++)
+        {
+            pts[i] = nodes[i].first;
+            id[i]  = nodes[i].second;
+        }
+    }
+
+    void build(std::vector<std::pair<point_t, size_t>> & nodes, size_t lo, size_t hi, int depth,
+        int spawn)
+    {
+        if (hi - lo <= LEAF)
+            return;
+
+        size_t mid = lo + (hi - lo) / 2;
+        int    dim = depth & 1;
+
+        std::nth_element(nodes.begin() + lo, nodes.begin() + mid, nodes.begin() + hi,
+            [dim](const std::pair<point_t, size_t> & a, const std::pair<point_t, size_t> & b) {
+                return coord(a.first, dim) < coord(b.first, dim);
+            });
+
+        if (depth < spawn && hi - lo > (1 << 16))
+        {
+            std::thread left([&] { build(nodes, lo, mid, depth + 1, spawn); });
+            build(nodes, mid + 1, hi, depth + 1, spawn);
+            left.join();
+        }
+        else
+        {
+            build(nodes, lo, mid, depth + 1, spawn);
+            build(nodes, mid + 1, hi, depth + 1, spawn);
+        }
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void nearest(point_t q, size_t lo, size_t hi, int depth, double & best, size_t & at) const
+    {
+        if (hi - lo <= LEAF)
+        {
+            for (size_t i = lo; i < hi; i++)
+            {
+                double d2 = distance2(q, pts[i]);
+                if (d2 < best)
+                {
+                    best = d2;
+                    at   = i;
+                }
+            }
+            return;
+        }
+
+        size_t mid  = lo + (hi - lo) / 2;
+        double diff = coord(q, depth & 1) - coord(pts[mid], depth & 1);
+        double d2   = distance2(q, pts[mid]);
+
+        if (d2 < best)
+        {
+            best = d2;
+            at   = mid;
+        }
+
+        // sisi yang memuat q terlebih dahulu, sisi lain hanya bila bidang pemisah lebih dekat
+        if (diff < 0)
+        {
+            nearest(q, lo, mid, depth + 1, best, at);
+            if (diff * diff < best)
+                nearest(q, mid + 1, hi, depth + 1, best, at);
+        }
+        else
+        {
+            nearest(q, mid + 1, hi, depth + 1, best, at);
+            if (diff * diff < best)
+                nearest(q, lo, mid, depth + 1, best, at);
+        }
+    }
+
+    // indeks titik terdekat, SIZE_MAX bila index kosong
+    size_t nearest(point_t q) const
+    {
+        double best = std::numeric_limits<double>::infinity();
+        size_t at   = SIZE_MAX;
+
+        nearest(q, 0, pts.size(), 0, best, at);
+        return (at == SIZE_MAX) ? SIZE_MAX : id[at];
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void knn(point_t q, size_t k, size_t lo, size_t hi, int depth, candidates_t & heap) const
+    {
+        if (hi - lo <= LEAF)
+        {
+            for (size_t i = lo; i < hi; i++)
+                offer(heap, k, distance2(q, pts[i]), id[i]);
+            return;
+        }
+
+        size_t mid  = lo + (hi - lo) / 2;
+        double diff = coord(q, depth & 1) - coord(pts[mid], depth & 1);
+
+        offer(heap, k, distance2(q, pts[mid]), id[mid]);
+
+        size_t nlo = (diff < 0) ? lo : mid + 1, nhi = (diff < 0) ? mid : hi;
+        size_t flo = (diff < 0) ? mid + 1 : lo, fhi = (diff < 0) ? hi : mid;
+
+        knn(q, k, nlo, nhi, depth + 1, heap);
+        if (heap.size() < k || diff * diff < heap.top().first)
+            knn(q, k, flo, fhi, depth + 1, heap);
+    }
+
+    // k titik terdekat, terurut dari yang terdekat
+    std::vector<size_t> knn(point_t q, size_t k) const
+    {
+        candidates_t heap;
+
+        if (k > 0)
+            knn(q, k, 0, pts.size(), 0, heap);
+        return drain(heap);
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void radius(point_t q, double r2, size_t lo, size_t hi, int depth,
+        std::vector<size_t> & result) const
+    {
+        if (hi - lo <= LEAF)
+        {
+            for (size_t i = lo; i < hi; i++)
+                if (distance2(q, pts[i]) <= r2)
+                    result.push_back(id[i]);
+            return;
+        }
+
+        size_t mid  = lo + (hi - lo) / 2;
+        double diff = coord(q, depth & 1) - coord(pts[mid], depth & 1);
+
+        if (distance2(q, pts[mid]) <= r2)
+            result.push_back(id[mid]);
+
+        if (diff <= 0 || diff * diff <= r2)
+            radius(q, r2, lo, mid, depth + 1, result);
+        if (diff >= 0 || diff * diff <= r2)
+            radius(q, r2, mid + 1, hi, depth + 1, result);
+    }
+
+    // seluruh titik dengan jarak <= r dari q
+    std::vector<size_t> radius(point_t q, double r) const
+    {
+        std::vector<size_t> result;
+
+        radius(q, r * r, 0, pts.size(), 0, result);
+        return result;
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    void box(point_t blo, point_t bhi, size_t lo, size_t hi, int depth,
+        std::vector<size_t> & result) const
+    {
+        auto inside = [&](point_t p) {
+            return p.x >= blo.x && p.x <= bhi.x && p.y >= blo.y && p.y <= bhi.y;
+        };
+
+        if (hi - lo <= LEAF)
+        {
+            for (size_t i = lo; i < hi; i++)
+                if (inside(pts[i]))
+                    result.push_back(id[i]);
+            return;
+        }
+
+        size_t mid   = lo + (hi - lo) / 2;
+        int    dim   = depth & 1;
+        double split = coord(pts[mid], dim);
+
+        if (inside(pts[mid]))
+            result.push_back(id[mid]);
+
+        if (coord(blo, dim) <= split)
+            box(blo, bhi, lo, mid, depth + 1, result);
+        if (coord(bhi, dim) >= split)
+            box(blo, bhi, mid + 1, hi, depth + 1, result);
+    }
+
+    // seluruh titik di dalam kotak [lo, hi] (tepi termasuk)
+    std::vector<size_t> box(point_t lo, point_t hi) const
+    {
+        std::vector<size_t> result;
+
+        box(lo, hi, 0, pts.size(), 0, result);
+        return result;
+    }
+};
+
+// ======================================================================================
+
+/** Uniform Grid **/
+
+/*
+    Bounding box titik dibagi menjadi cols x rows cell berukuran cell x cell. Titik pada
+    cell c tersimpan di pts[start[c] .. start[c + 1]) (compressed sparse row).
+
+    Bila ukuran cell tidak diberikan, ukuran dipilih sehingga rata-rata sekitar 2 titik
+    per cell. Jumlah cell dibatasi sekitar 4n agar memory tetap O(n).
+
+    Pembangunan paralel memakai satu histogram bersama (atomic uint32_t per cell), bukan
+    histogram per thread yang membutuhkan thread x cell counter. Prefix sum mengubah
+    histogram menjadi kursor tulis per cell, lalu setiap thread mengambil posisi dengan
+    fetch_add. Urutan dalam cell menjadi tidak menentu sehingga setiap cell (rata-rata
+    ~2 titik) diurutkan kembali berdasarkan id agar hasil stabil. Syarat N < 2^32.
+
+    k-NN dilakukan dengan menelusuri cincin cell di sekitar cell query: cincin ke-r berisi
+    cell dengan jarak Chebyshev r. Setiap titik di luar cincin 0 .. r - 1 berjarak minimal
+    (r - 1) * cell dari q, sehingga penelusuran berhenti setelah k kandidat terkumpul dan
+    batas tersebut melewati kandidat terjauh.
+*/
+
+struct grid_t
+{
+    double min_x, min_y, cell;
+    size_t cols, rows;
+
+    std::vector<size_t>  start;
+    std::vector<point_t> pts;
+    std::vector<size_t>  id;
+
+    grid_t(const point_t arr[], size_t N, double cell_size = 0, bool parallel = true)
+    {
+        double max_x, max_y;
+
+        min_x = min_y = std::numeric_limits<double>::infinity();
+        max_x = max_y = - std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < N; i++)
+        {
+            min_x = std::min(min_x, arr[i].x);  max_x = std::max(max_x, arr[i].x);
+            min_y = std::min(min_y, arr[i].y);  max_y = std::max(max_y, arr[i].y);
+        }
+
+        if (N == 0)
+            min_x = min_y = max_x = max_y = 0;
+
+        double w = max_x - min_x, h = max_y - min_y;
+
+        cell = cell_size;
+        if (cell <= 0)
+        {
+            cell = (w > 0 && h > 0) ? std::sqrt(2 * w * h / std::max<size_t>(N, 1))
+                                    : 2 * std::max(w, h) / std::max<size_t>(N, 1);
+            if (cell <= 0)
+                cell = 1;
+        }
+
+        // batasi jumlah cell
+        while ((w / cell + 1) * (h / cell + 1) > 4.0 * N + 16)
+            cell *= 2;
+
+        cols = (size_t) (w / cell) + 1;
+        rows = (size_t) (h / cell) + 1;
+
+        size_t cells    = cols * rows;
+        size_t nthreads = (parallel && N >= (1 << 18)) ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+        size_t chunk    = (N + nthreads - 1) / nthreads;
+
+        std::vector<uint32_t> cell_of(N);
+        std::vector<std::atomic<uint32_t>> cursor(cells);
+
+        for (auto & c : cursor)
+            c.store(0, std::memory_order_relaxed);
+
+        auto run = [&](auto job) {
+            std::vector<std::thread> workers;
+            for (size_t t = 1; t < nthreads; t++)
+                workers.emplace_back(job, t);
+            job(0);
+            for (auto & w : workers)
+                w.join();
+        };
+
+        // satu thread: tanpa instruksi atomic, penyebaran berurutan sudah stabil
+        auto bump = [&](uint32_t c) -> uint32_t {
+            if (nthreads == 1)
+            {
+                uint32_t v = cursor[c].load(std::memory_order_relaxed);
+                cursor[c].store(v + 1, std::memory_order_relaxed);
+                return v;
+            }
+            return cursor[c].fetch_add(1, std::memory_order_relaxed);
+        };
+
+        // histogram bersama
+        run([&](size_t t) {
+            for (size_t i = t * chunk; i < std::min(N, (t + 1) * chunk); i++)
+            {
+                cell_of[i] = (uint32_t) index(cell_x(arr[i].x), cell_y(arr[i].y));
+                bump(cell_of[i]);
+            }
+        });
+
+        // prefix sum: cursor[c] menjadi offset tulis awal cell c
+        start.assign(cells + 1, 0);
+        size_t offset = 0;
+        for (size_t c = 0; c < cells; c++)
+        {
+            start[c] = offset;
+            offset  += cursor[c].load(std::memory_order_relaxed);
+            cursor[c].store((uint32_t) start[c], std::memory_order_relaxed);
+        }
+        start[cells] = offset;
+
+        // sebar titik ke posisinya
+        pts.resize(N);
+        id.resize(N);
+        run([&](size_t t) {
+            for (size_t i = t * chunk; i < std::min(N, (t + 1) * chunk); i++)
+            {
+                size_t at = bump(cell_of[i]);
+                pts[at] = arr[i];
+                id[at]  = i;
+            }
+        });
+
+        if (nthreads == 1)
+            return;
+
+        // kembalikan urutan stabil di dalam cell: insertion sort untuk cell kecil,
+        // std::sort untuk cell padat (data menggerombol)
+        size_t cell_chunk = (cells + nthreads - 1) / nthreads;
+        run([&](size_t t) {
+            std::vector<std::pair<size_t, point_t>> tmp;
+
+            for (size_t c = t * cell_chunk; c < std::min(cells, (t + 1) * cell_chunk); c++)
+            {
+                size_t lo = start[c], hi = start[c + 1];
+
+                if (hi - lo > 32)
+                {
+                    tmp.clear();
+                    for (size_t i = lo; i < hi; i++)
+                        tmp.emplace_back(id[i], pts[i]);
+
+                    std::sort(tmp.begin(), tmp.end(),
+                        [](const std::pair<size_t, point_t> & a, const std::pair<size_t, point_t> & b) {
+                            return a.first < b.first;
+                        });
+
+                    for (size_t i = lo; i < hi; i++)
+                    {
+                        id[i]  = tmp[i - lo].first;
+                        pts[i] = tmp[i - lo].second;
+                    }
+                    continue;
+                }
+
+                for (size_t i = lo + 1; i < hi; i++)
+                {
+                    point_t p = pts[i];
+                    size_t  k = id[i], j = i;
+
+                    for (; j > lo && id[j - 1] > k; j--)
+                    {
+                        pts[j] = pts[j - 1];
+                        id[j]  = id[j - 1];
+                    }
+
+                    pts[j] = p;
+                    id[j]  = k;
+                }
+            }
+        });
+    }
+
+    // kolom / baris cell untuk sebuah koordinat, dipotong ke dalam grid
+    size_t cell_x(double x) const
+    {
+        double c = std::floor((x - min_x) / cell);
+        return (c <= 0) ? 0 : (c >= cols - 1) ? cols - 1 : (size_t) c;
+    }
+
+    size_t cell_y(double y) const
+    {
+        double c = std::floor((y - min_y) / cell);
+        return (c <= 0) ? 0 : (c >= rows - 1) ? rows - 1 : (size_t) c;
+    }
+
+    size_t index(size_t cx, size_t cy) const
+    {
+        return cy * cols + cx;
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    // kunjungi seluruh titik dalam cell [cx0, cx1] x [cy0, cy1]
+    template <typename Visit>
+    void scan(size_t cx0, size_t cx1, size_t cy0, size_t cy1, Visit visit) const
+    {
+        for (size_t cy = cy0; cy <= cy1; cy++)
+        {
+            // cell dalam satu baris bersebelahan di memory
+            size_t from = start[index(cx0, cy)], to = start[index(cx1, cy) + 1];
+            for (size_t i = from; i < to; i++)
+                visit(i);
+        }
+    }
+
+    // seluruh titik dengan jarak <= r dari q
+    std::vector<size_t> radius(point_t q, double r) const
+    {
+        std::vector<size_t> result;
+
+        if (pts.empty() || q.x + r < min_x || q.y + r < min_y ||
+            q.x - r > min_x + cols * cell || q.y - r > min_y + rows * cell)
+            return result;
+
+        double r2 = r * r;
+        scan(cell_x(q.x - r), cell_x(q.x + r), cell_y(q.y - r), cell_y(q.y + r), [&](size_t i) {
+            if (distance2(q, pts[i]) <= r2)
+                result.push_back(id[i]);
+        });
+
+        return result;
+    }
+
+    // seluruh titik di dalam kotak [lo, hi] (tepi termasuk)
+    std::vector<size_t> box(point_t lo, point_t hi) const
+    {
+        std::vector<size_t> result;
+
+        if (pts.empty() || hi.x < min_x || hi.y < min_y ||
+            lo.x > min_x + cols * cell || lo.y > min_y + rows * cell)
+            return result;
+
+        scan(cell_x(lo.x), cell_x(hi.x), cell_y(lo.y), cell_y(hi.y), [&](size_t i) {
+            point_t p = pts[i];
+            if (p.x >= lo.x && p.x <= hi.x && p.y >= lo.y && p.y <= hi.y)
+                result.push_back(id[i]);
+        });
+
+        return result;
+    }
+
+    // ----------------------------------------------------------------------------------
+
+    // k titik terdekat, terurut dari yang terdekat
+    std::vector<size_t> knn(point_t q, size_t k) const
+    {
+        candidates_t heap;
+
+        if (pts.empty() || k == 0)
+            return drain(heap);
+
+        // posisi cell q tanpa dipotong, q boleh berada di luar grid
+        const double LIMIT = 1e15;
+        int64_t cx = (int64_t) std::max(-LIMIT, std::min(LIMIT, std::floor((q.x - min_x) / cell)));
+        int64_t cy = (int64_t) std::max(-LIMIT, std::min(LIMIT, std::floor((q.y - min_y) / cell)));
+        int64_t C  = cols, R = rows;
+
+        auto outside = [](int64_t v, int64_t n) -> int64_t {
+            return (v < 0) ? -v : (v >= n) ? v - n + 1 : 0;
+        };
+
+        int64_t r0   = std::max(outside(cx, C), outside(cy, R));
+        int64_t rmax = std::max(std::max(cx, C - 1 - cx), std::max(cy, R - 1 - cy));
+
+        auto visit_row = [&](int64_t y, int64_t x0, int64_t x1) {
+            if (y < 0 || y >= R)
+                return;
+            x0 = std::max<int64_t>(x0, 0);
+            x1 = std::min<int64_t>(x1, C - 1);
+            if (x0 > x1)
+                return;
+            scan(x0, x1, y, y, [&](size_t i) {
+                offer(heap, k, distance2(q, pts[i]), id[i]);
+            });
+        };
+
+        for (int64_t r = r0; r <= rmax; r++)
+        {
+            double bound = (r - 1) * cell;
+            if (r > 0 && heap.size() == k && bound * bound >= heap.top().first)
+                break;
+
+            if (r == 0)
+            {
+                visit_row(cy, cx, cx);
+                continue;
+            }
+
+            visit_row(cy - r, cx - r, cx + r);
+            visit_row(cy + r, cx - r, cx + r);
+            for (int64_t y = std::max<int64_t>(cy - r + 1, 0); y <= std::min<int64_t>(cy + r - 1, R - 1); y++)
+            {
+                visit_row(y, cx - r, cx - r);
+                visit_row(y, cx + r, cx + r);
+            }
+        }
+
+        return drain(heap);
+    }
+
+    // indeks titik terdekat, SIZE_MAX bila index kosong
+    size_t nearest(point_t q) const
+    {
+        std::vector<size_t> result = knn(q, 1);
+        return result.empty() ? SIZE_MAX : result[0];
+    }
+};
+
+// ======================================================================================
+
+/** Batch Query **/
+
+/*
+    Query diurutkan menurut Morton order (Z-order) atas bounding box query: bit koordinat
+    x dan y yang dikuantisasi ke 16 bit disisipkan bergantian. Query yang berdekatan di
+    ruang berdekatan pula di urutan, sehingga node / cell yang dikunjungi query sebelumnya
+    masih berada di cache. Urutan kemudian dibagi menjadi potongan yang diambil oleh
+    banyak thread.
+*/
+
+uint32_t spread_bits(uint32_t v)
+{
+    v = (v | (v << 8)) & 0x00FF00FF;
+    v = (v | (v << 4)) & 0x0F0F0F0F;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}
+
+std::vector<size_t> morton_order(const point_t query[], size_t M)
+{
+    double min_x = std::numeric_limits<double>::infinity(), max_x = - min_x;
+    double min_y = min_x, max_y = max_x;
+
+    for (size_t i = 0; i < M; i++)
+    {
+        min_x = std::min(min_x, query[i].x);  max_x = std::max(max_x, query[i].x);
+        min_y = std::min(min_y, query[i].y);  max_y = std::max(max_y, query[i].y);
+    }
+
+    double sx = (max_x > min_x) ? 65535 / (max_x - min_x) : 0;
+    double sy = (max_y > min_y) ? 65535 / (max_y - min_y) : 0;
+
+    std::vector<std::pair<uint32_t, size_t>> keyed(M);
+    for (size_t i = 0; i < M; i++)
+    {
+        uint32_t qx = (uint32_t) ((query[i].x - min_x) * sx);
+        uint32_t qy = (uint32_t) ((query[i].y - min_y) * sy);
+        keyed[i] = { spread_bits(qx) | (spread_bits(qy) << 1), i };
+    }
+    std::sort(keyed.begin(), keyed.end());
+
+    std::vector<size_t> order(M);
+    for (size_t i = 0; i < M; i++)
+        order[i] = keyed[i].second;
+
+    return order;
+}
+
+// jalankan job(i) untuk setiap query i dalam Morton order, paralel
+template <typename Job>
+void batch(const point_t query[], size_t M, Job job)
+{
+    const size_t CHUNK = 1024;
+
+    std::vector<size_t> order = morton_order(query, M);
+    std::atomic<size_t> next(0);
+
+    auto worker = [&] {
+        size_t begin;
+        while ((begin = next.fetch_add(CHUNK)) < M)
+            for (size_t i = begin; i < std::min(M, begin + CHUNK); i++)
+                job(order[i]);
+    };
+
+    size_t nthreads = (M >= 4 * CHUNK) ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+    std::vector<std::thread> workers;
+
+    for (size_t t = 1; t < nthreads; t++)
+        workers.emplace_back(worker);
+    worker();
+    for (auto & w : workers)
+        w.join();
+}
+
+// out[i] = indeks titik terdekat dari query[i]
+template <typename Index>
+void nearest(const Index & index, const point_t query[], size_t M, size_t out[])
+{
+    batch(query, M, [&](size_t i) {
+        out[i] = index.nearest(query[i]);
+    });
+}
+
+// out[i * k .. i * k + k) = k titik terdekat dari query[i], sisanya SIZE_MAX bila n < k
+template <typename Index>
+void knn(const Index & index, const point_t query[], size_t M, size_t k, size_t out[])
+{
+    batch(query, M, [&](size_t i) {
+        std::vector<size_t> result = index.knn(query[i], k);
+
+        std::copy(result.begin(), result.end(), out + i * k);
+        std::fill(out + i * k + result.size(), out + (i + 1) * k, SIZE_MAX);
+    });
+}
+
+// result[i] = seluruh titik dengan jarak <= r dari query[i]
+template <typename Index>
+std::vector<std::vector<size_t>> radius(const Index & index, const point_t query[], size_t M, double r)
+{
+    std::vector<std::vector<size_t>> result(M);
+
+    batch(query, M, [&](size_t i) {
+        result[i] = index.radius(query[i], r);
+    });
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Nearest neighbour untuk banyak query **/
+
+void algorithm(const point_t arr[], size_t N, const point_t query[], size_t M, size_t out[])
+{
+    kd_tree_t tree(arr, N);
+
+    nearest(tree, query, M, out);
+}
\ No newline at end of file
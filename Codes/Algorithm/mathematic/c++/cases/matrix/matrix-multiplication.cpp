@@ -0,0 +1,405 @@
+/*
+    Matrix Multiplication
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Matrix)
+
+Compile:
+    [clang]
+    $ clang++ -std=c++14 -O3 -mavx2 -mfma -pthread matrix-multiplication.cpp -o matrix-multiplication
+
+    [gcc]
+    $ g++ -std=c++14 -O3 -mavx2 -mfma -pthread matrix-multiplication.cpp -o matrix-multiplication
+
+    [msvc]
+    $ cl /std:c++14 /O2 /arch:AVX2 matrix-multiplication.cpp
+
+Run:
+    $ matrix-multiplication
+*/
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+/*
+    Perkalian matriks C = A * B (GEMM) dengan A berukuran m x k, B berukuran k x n.
+
+    Versi brute-force (lihat brute-force/c++/cases/matrix-multiplication.cpp) melakukan
+    2mnk operasi namun setiap elemen B dibaca ulang dari memory untuk setiap baris A.
+    Untuk matriks besar kecepatan dibatasi memory, bukan FPU.
+
+    Dua engine:
+
+    1. Blocked (susunan GotoBLAS / BLIS), untuk float, double, dan int32_t dengan AVX2:
+
+        for jc in n step NC                 panel B (KC x NC) muat di L3
+          for pc in k step KC
+            pack B[pc:pc+KC, jc:jc+NC]
+            for ic in m step MC             blok A (MC x KC) muat di L2
+              pack A[ic:ic+MC, pc:pc+KC]
+              for jr in NC step NR          micro-panel B (KC x NR) muat di L1
+                for ir in MC step MR
+                  micro-kernel: C[MR x NR] += A~[MR x KC] * B~[KC x NR]
+
+       Packing menyusun ulang potongan A dan B sehingga micro-kernel membaca memory
+       secara berurutan. Micro-kernel menyimpan seluruh tile C (MR x NR) di register
+       AVX2 dan melakukan satu broadcast A dan beberapa FMA per langkah.
+
+    2. Cache-oblivious recursive, untuk tipe lain (int64_t, modint, dsb.) atau tanpa AVX2:
+       dimensi terbesar dibelah dua hingga sub-problem kecil sehingga pada suatu tingkat
+       rekursi sub-problem pasti muat di setiap level cache, tanpa perlu mengetahui ukuran
+       cache.
+
+    Paralelisasi: baris C dibagi menjadi beberapa slab yang dikerjakan oleh thread berbeda.
+    Setiap thread memiliki buffer packing sendiri sehingga tidak ada sinkronisasi.
+
+    Semua matriks row-major. ld (leading dimension) adalah jarak antar baris sehingga
+    sub-matriks dapat diproses tanpa salinan.
+*/
+
+// ======================================================================================
+
+template <typename T>
+struct matrix_t
+{
+    size_t rows, cols;
+    std::vector<T> data;
+
+    matrix_t(size_t r = 0, size_t c = 0) : rows(r), cols(c), data(r * c, T()) {}
+
+    T *       operator[](size_t i)          { return data.data() + i * cols; }
+    const T * operator[](size_t i) const    { return data.data() + i * cols; }
+};
+
+// ======================================================================================
+
+/** Cache-oblivious Recursive **/
+
+// C[m x n] += A[m x k] * B[k x n]
+template <typename T>
+void recursive(const T * A, size_t lda, const T * B, size_t ldb, T * C, size_t ldc,
+    size_t m, size_t n, size_t k)
+{
+    // sub-problem kecil: loop i-p-j, baris B dan C dibaca berurutan
+    if (m * n * k <= 32 * 32 * 32)
+    {
+        for (size_t i = 0; i < m; i++)
+            for (size_t p = 0; p < k; p++)
+            {
+                T a = A[i * lda + p];
+                for (size_t j = 0; j < n; j++)
+                    C[i * ldc + j] = C[i * ldc + j] + a * B[p * ldb + j];
+            }
+        return;
+    }
+
+    if (m >= n && m >= k)
+    {
+        size_t h = m / 2;
+        recursive(A, lda, B, ldb, C, ldc, h, n, k);
+        recursive(A + h * lda, lda, B, ldb, C + h * ldc, ldc, m - h, n, k);
+    }
+    else if (n >= k)
+    {
+        size_t h = n / 2;
+        recursive(A, lda, B, ldb, C, ldc, m, h, k);
+        recursive(A, lda, B + h, ldb, C + h, ldc, m, n - h, k);
+    }
+    else
+    {
+        size_t h = k / 2;
+        recursive(A, lda, B, ldb, C, ldc, m, n, h);
+        recursive(A + h, lda, B + h * ldb, ldb, C, ldc, m, n, k - h);
+    }
+}
+
+// ======================================================================================
+
+/** Micro-kernel **/
+
+/*
+    gemm_traits<T> menentukan ukuran tile register (MR x NR), ukuran blok cache (KC, MC,
+    NC), dan micro-kernel:
+
+        kernel(kc, a, b, c, ldc):  C[MR x NR] += sum_p a[p * MR + i] * b[p * NR + j]
+
+    simd = false berarti tidak ada micro-kernel khusus sehingga engine recursive dipakai.
+*/
+
+template <typename T>
+struct gemm_traits
+{
+    static const bool simd = false;
+};
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+template <>
+struct gemm_traits<double>
+{
+    static const bool   simd = true;
+    static const size_t MR = 6, NR = 8, KC = 256, MC = 96, NC = 2048;
+
+    static void kernel(size_t kc, const double * a, const double * b, double * c, size_t ldc)
+    {
+        __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+        __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+        __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+        __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+        __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+        __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+        for (size_t p = 0; p < kc; p++, a += MR, b += NR)
+        {
+            __m256d b0 = _mm256_load_pd(b), b1 = _mm256_load_pd(b + 4), x;
+
+            x = _mm256_broadcast_sd(a + 0); c00 = _mm256_fmadd_pd(x, b0, c00); c01 = _mm256_fmadd_pd(x, b1, c01);
+            x = _mm256_broadcast_sd(a + 1); c10 = _mm256_fmadd_pd(x, b0, c10); c11 = _mm256_fmadd_pd(x, b1, c11);
+            x = _mm256_broadcast_sd(a + 2); c20 = _mm256_fmadd_pd(x, b0, c20); c21 = _mm256_fmadd_pd(x, b1, c21);
+            x = _mm256_broadcast_sd(a + 3); c30 = _mm256_fmadd_pd(x, b0, c30); c31 = _mm256_fmadd_pd(x, b1, c31);
+            x = _mm256_broadcast_sd(a + 4); c40 = _mm256_fmadd_pd(x, b0, c40); c41 = _mm256_fmadd_pd(x, b1, c41);
+            x = _mm256_broadcast_sd(a + 5); c50 = _mm256_fmadd_pd(x, b0, c50); c51 = _mm256_fmadd_pd(x, b1, c51);
+        }
+
+        __m256d acc[MR][2] = { { c00, c01 }, { c10, c11 }, { c20, c21 },
+                               { c30, c31 }, { c40, c41 }, { c50, c51 } };
+        for (size_t i = 0; i < MR; i++, c += ldc)
+        {
+            _mm256_storeu_pd(c,     _mm256_add_pd(_mm256_loadu_pd(c),     acc[i][0]));
+            _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), acc[i][1]));
+        }
+    }
+};
+
+template <>
+struct gemm_traits<float>
+{
+    static const bool   simd = true;
+    static const size_t MR = 6, NR = 16, KC = 256, MC = 96, NC = 4096;
+
+    static void kernel(size_t kc, const float * a, const float * b, float * c, size_t ldc)
+    {
+        __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+        __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+        __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+        __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+        __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+        __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+        for (size_t p = 0; p < kc; p++, a += MR, b += NR)
+        {
+            __m256 b0 = _mm256_load_ps(b), b1 = _mm256_load_ps(b + 8), x;
+
+            x = _mm256_broadcast_ss(a + 0); c00 = _mm256_fmadd_ps(x, b0, c00); c01 = _mm256_fmadd_ps(x, b1, c01);
+            x = _mm256_broadcast_ss(a + 1); c10 = _mm256_fmadd_ps(x, b0, c10); c11 = _mm256_fmadd_ps(x, b1, c11);
+            x = _mm256_broadcast_ss(a + 2); c20 = _mm256_fmadd_ps(x, b0, c20); c21 = _mm256_fmadd_ps(x, b1, c21);
+            x = _mm256_broadcast_ss(a + 3); c30 = _mm256_fmadd_ps(x, b0, c30); c31 = _mm256_fmadd_ps(x, b1, c31);
+            x = _mm256_broadcast_ss(a + 4); c40 = _mm256_fmadd_ps(x, b0, c40); c41 = _mm256_fmadd_ps(x, b1, c41);
+            x = _mm256_broadcast_ss(a + 5); c50 = _mm256_fmadd_ps(x, b0, c50); c51 = _mm256_fmadd_ps(x, b1, c51);
+        }
+
+        __m256 acc[MR][2] = { { c00, c01 }, { c10, c11 }, { c20, c21 },
+                              { c30, c31 }, { c40, c41 }, { c50, c51 } };
+        for (size_t i = 0; i < MR; i++, c += ldc)
+        {
+            _mm256_storeu_ps(c,     _mm256_add_ps(_mm256_loadu_ps(c),     acc[i][0]));
+            _mm256_storeu_ps(c + 8, _mm256_add_ps(_mm256_loadu_ps(c + 8), acc[i][1]));
+        }
+    }
+};
+
+// int32_t: tidak ada FMA integer di AVX2, perkalian dengan vpmulld lalu vpaddd
+template <>
+struct gemm_traits<int32_t>
+{
+    static const bool   simd = true;
+    static const size_t MR = 6, NR = 16, KC = 256, MC = 96, NC = 4096;
+
+    static void kernel(size_t kc, const int32_t * a, const int32_t * b, int32_t * c, size_t ldc)
+    {
+        __m256i acc[MR][2];
+        for (size_t i = 0; i < MR; i++)
+            acc[i][0] = acc[i][1] = _mm256_setzero_si256();
+
+        for (size_t p = 0; p < kc; p++, a += MR, b += NR)
+        {
+            __m256i b0 = _mm256_load_si256((const __m256i *) b);
+            __m256i b1 = _mm256_load_si256((const __m256i *) (b + 8));
+
+            for (size_t i = 0; i < MR; i++)
+            {
+                __m256i x = _mm256_set1_epi32(a[i]);
+                acc[i][0] = _mm256_add_epi32(acc[i][0], _mm256_mullo_epi32(x, b0));
+                acc[i][1] = _mm256_add_epi32(acc[i][1], _mm256_mullo_epi32(x, b1));
+            }
+        }
+
+        for (size_t i = 0; i < MR; i++, c += ldc)
+        {
+            __m256i * row = (__m256i *) c;
+            _mm256_storeu_si256(row,     _mm256_add_epi32(_mm256_loadu_si256(row),     acc[i][0]));
+            _mm256_storeu_si256(row + 1, _mm256_add_epi32(_mm256_loadu_si256(row + 1), acc[i][1]));
+        }
+    }
+};
+
+#endif
+
+// ======================================================================================
+
+/** Blocked GEMM **/
+
+// buffer packing dengan alignment 32 byte untuk load AVX2
+template <typename T>
+struct aligned_buffer_t
+{
+    std::vector<T> raw;
+    T * ptr;
+
+    aligned_buffer_t(size_t n) : raw(n + 32 / sizeof(T))
+    {
+        uintptr_t p = (uintptr_t) raw.data();
+        ptr = (T *) ((p + 31) & ~(uintptr_t) 31);
+    }
+};
+
+// A[mc x kc] menjadi micro-panel MR baris: buf[panel][p][i], baris di luar mc diisi 0
+template <typename T, size_t MR>
+void pack_a(const T * A, size_t lda, size_t mc, size_t kc, T * buf)
+{
+    for (size_t ir = 0; ir < mc; ir += MR)
+        for (size_t p = 0; p < kc; p++)
+            for (size_t i = 0; i < MR; i++)
+                *buf++ = (ir + i < mc) ? A[(ir + i) * lda + p] : T();
+}
+
+// B[kc x nc] menjadi micro-panel NR kolom: buf[panel][p][j], kolom di luar nc diisi 0
+template <typename T, size_t NR>
+void pack_b(const T * B, size_t ldb, size_t kc, size_t nc, T * buf)
+{
+    for (size_t jr = 0; jr < nc; jr += NR)
+        for (size_t p = 0; p < kc; p++)
+        {
+            const T * row = B + p * ldb + jr;
+            for (size_t j = 0; j < NR; j++)
+                *buf++ = (jr + j < nc) ? row[j] : T();
+        }
+}
+
+// C[m x n] += A[m x k] * B[k x n], satu thread
+template <typename T>
+void blocked(const T * A, size_t lda, const T * B, size_t ldb, T * C, size_t ldc,
+    size_t m, size_t n, size_t k)
+{
+    typedef gemm_traits<T> G;
+    const size_t MR = G::MR, NR = G::NR, KC = G::KC, MC = G::MC, NC = G::NC;
+
+    aligned_buffer_t<T> pa(MC * KC), pb(KC * ((NC + NR - 1) / NR * NR));
+    T tile[MR * NR];
+
+    for (size_t jc = 0; jc < n; jc += NC)
+    {
+        size_t nc = std::min(NC, n - jc);
+
+        for (size_t pc = 0; pc < k; pc += KC)
+        {
+            size_t kc = std::min(KC, k - pc);
+            pack_b<T, NR>(B + pc * ldb + jc, ldb, kc, nc, pb.ptr);
+
+            for (size_t ic = 0; ic < m; ic += MC)
+            {
+                size_t mc = std::min(MC, m - ic);
+                pack_a<T, MR>(A + ic * lda + pc, lda, mc, kc, pa.ptr);
+
+                for (size_t jr = 0; jr < nc; jr += NR)
+                {
+                    for (size_t ir = 0; ir < mc; ir += MR)
+                    {
+                        const T * a = pa.ptr + ir * kc;
+                        const T * b = pb.ptr + jr * kc;
+                        T *       c = C + (ic + ir) * ldc + jc + jr;
+
+                        if (ir + MR <= mc && jr + NR <= nc)
+                        {
+                            G::kernel(kc, a, b, c, ldc);
+                            continue;
+                        }
+
+                        // tile di tepi: hitung penuh di buffer, salin bagian yang valid
+                        std::fill(tile, tile + MR * NR, T());
+                        G::kernel(kc, a, b, tile, NR);
+
+                        for (size_t i = 0; i < std::min(MR, mc - ir); i++)
+                            for (size_t j = 0; j < std::min(NR, nc - jr); j++)
+                                c[i * ldc + j] += tile[i * NR + j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// ======================================================================================
+
+/** Dispatch dan Paralelisasi **/
+
+template <typename T>
+void gemm_serial(const T * A, size_t lda, const T * B, size_t ldb, T * C, size_t ldc,
+    size_t m, size_t n, size_t k, std::true_type)
+{
+    blocked(A, lda, B, ldb, C, ldc, m, n, k);
+}
+
+template <typename T>
+void gemm_serial(const T * A, size_t lda, const T * B, size_t ldb, T * C, size_t ldc,
+    size_t m, size_t n, size_t k, std::false_type)
+{
+    recursive(A, lda, B, ldb, C, ldc, m, n, k);
+}
+
+// C[m x n] += A[m x k] * B[k x n]
+template <typename T>
+void gemm(const T * A, size_t lda, const T * B, size_t ldb, T * C, size_t ldc,
+    size_t m, size_t n, size_t k, bool parallel = true)
+{
+    std::integral_constant<bool, gemm_traits<T>::simd> engine;
+
+    // slab minimal 64 baris agar packing B per thread tidak mendominasi
+    size_t nthreads = parallel ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+    nthreads = std::max<size_t>(1, std::min(nthreads, m / 64));
+
+    if (nthreads == 1 || (double) m * n * k < 1e6)
+    {
+        gemm_serial(A, lda, B, ldb, C, ldc, m, n, k, engine);
+        return;
+    }
+
+    size_t slab = (m + nthreads - 1) / nthreads;
+    std::vector<std::thread> workers;
+
+    for (size_t lo = 0; lo < m; lo += slab)
+    {
+        size_t rows = std::min(slab, m - lo);
+        workers.emplace_back([=] {
+            gemm_serial(A + lo * lda, lda, B, ldb, C + lo * ldc, ldc, rows, n, k, engine);
+        });
+    }
+
+    for (auto & w : workers)
+        w.join();
+}
+
+template <typename T>
+matrix_t<T> algorithm(const matrix_t<T> & A, const matrix_t<T> & B)
+{
+    matrix_t<T> C(A.rows, B.cols);
+
+    gemm(A.data.data(), A.cols, B.data.data(), B.cols, C.data.data(), C.cols, A.rows, B.cols, A.cols);
+    return C;
+}
\ No newline at end of file
@@ -0,0 +1,328 @@
+/*
+    Big Integer
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Numbers)
+
+Compile:
+    [clang]
+    $ clang++ big-integer.cpp -o big-integer
+
+    [gcc]
+    $ g++ big-integer.cpp -o big-integer
+
+    [msvc]
+    $ cl big-integer.cpp
+
+Run:
+    $ big-integer
+*/
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+/*
+    Bilangan bulat non-negatif dengan presisi tak terbatas (arbitrary-precision).
+
+    Bilangan disimpan sebagai senarai limb 64-bit, limb ke-0 merupakan digit paling
+    rendah (little-endian) dalam basis 2^64:
+
+        value = limb[0] + limb[1] * 2^64 + limb[2] * 2^128 + ...
+
+    Nilai 0 direpresentasikan dengan senarai kosong. Limb 0 di posisi tertinggi selalu
+    dibuang (normalisasi).
+
+    Perkalian:
+    - schoolbook untuk operand kecil, O(n * m)
+    - karatsuba untuk operand besar, O(n^1.585)
+        a * b = z2 * B^2m + z1 * B^m + z0
+        z0 = a0 * b0
+        z2 = a1 * b1
+        z1 = (a0 + a1)(b0 + b1) - z0 - z2
+*/
+
+// ======================================================================================
+
+struct bigint_t
+{
+    std::vector<uint64_t> limb;
+
+    bigint_t(uint64_t value = 0)
+    {
+        if (value)
+            limb.push_back(value);
+    }
+
+    bool is_zero() const
+    {
+        return limb.empty();
+    }
+};
+
+// buang limb 0 di posisi tertinggi
+void normalize(bigint_t & a)
+{
+    while (! a.limb.empty() && a.limb.back() == 0)
+        a.limb.pop_back();
+}
+
+// bandingkan a dan b, hasil -1, 0, atau 1
+int compare(const bigint_t & a, const bigint_t & b)
+{
+    if (a.limb.size() != b.limb.size())
+        return (a.limb.size() < b.limb.size()) ? -1 : 1;
+
+    for (size_t i = a.limb.size(); i-- > 0; )
+    {
+        if (a.limb[i] != b.limb[i])
+            return (a.limb[i] < b.limb[i]) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+// ======================================================================================
+
+/** Penjumlahan dan Pengurangan **/
+
+// a += b * B^offset (B = 2^64)
+void add_shifted(bigint_t & a, const bigint_t & b, size_t offset = 0)
+{
+    if (a.limb.size() < b.limb.size() + offset)
+        a.limb.resize(b.limb.size() + offset, 0);
+
+    uint64_t carry = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 s = (unsigned __int128) a.limb[i + offset] + b.limb[i] + carry;
+        a.limb[i + offset] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+    }
+
+    // rambatkan carry
+    for (i += offset; carry && i < a.limb.size(); i++)
+    {
+        a.limb[i] += carry;
+        carry = (a.limb[i] == 0);
+    }
+
+    if (carry)
+        a.limb.push_back(carry);
+}
+
+bigint_t add(const bigint_t & a, const bigint_t & b)
+{
+    bigint_t result = a;
+    add_shifted(result, b);
+    return result;
+}
+
+// a -= b, dengan syarat a >= b
+void sub_inplace(bigint_t & a, const bigint_t & b)
+{
+    uint64_t borrow = 0;
+    size_t   i;
+
+    for (i = 0; i < b.limb.size(); i++)
+    {
+        unsigned __int128 d = (unsigned __int128) a.limb[i] - b.limb[i] - borrow;
+        a.limb[i] = (uint64_t) d;
+        borrow = (uint64_t) (d >> 127);
+    }
+
+    for (; borrow && i < a.limb.size(); i++)
+    {
+        borrow = (a.limb[i] == 0);
+        a.limb[i] --;
+    }
+
+    normalize(a);
+}
+
+bigint_t sub(const bigint_t & a, const bigint_t & b)
+{
+    bigint_t result = a;
+    sub_inplace(result, b);
+    return result;
+}
+
+// ======================================================================================
+
+/** Perkalian dan Pembagian dengan bilangan 64-bit **/
+
+void mul_small(bigint_t & a, uint64_t m)
+{
+    if (m == 0)
+    {
+        a.limb.clear();
+        return;
+    }
+
+    uint64_t carry = 0;
+    for (auto & x : a.limb)
+    {
+        unsigned __int128 p = (unsigned __int128) x * m + carry;
+        x = (uint64_t) p;
+        carry = (uint64_t) (p >> 64);
+    }
+
+    if (carry)
+        a.limb.push_back(carry);
+}
+
+// a /= d, mengembalikan sisa bagi
+uint64_t div_small(bigint_t & a, uint64_t d)
+{
+    unsigned __int128 rem = 0;
+
+    for (size_t i = a.limb.size(); i-- > 0; )
+    {
+        unsigned __int128 cur = (rem << 64) | a.limb[i];
+        a.limb[i] = (uint64_t) (cur / d);
+        rem = cur % d;
+    }
+
+    normalize(a);
+    return (uint64_t) rem;
+}
+
+// ======================================================================================
+
+/** Perkalian **/
+
+const size_t KARATSUBA_THRESHOLD = 32;
+
+// out[0 .. na + nb) = a * b, out harus bernilai 0 sebelumnya
+void mul_schoolbook(const uint64_t a[], size_t na, const uint64_t b[], size_t nb,
+    uint64_t out[])
+{
+    for (size_t i = 0; i < na; i++)
+    {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < nb; j++)
+        {
+            unsigned __int128 p = (unsigned __int128) a[i] * b[j] + out[i + j] + carry;
+            out[i + j] = (uint64_t) p;
+            carry = (uint64_t) (p >> 64);
+        }
+        out[i + nb] = carry;
+    }
+}
+
+// bentuk bigint_t dari potongan limb [low, high)
+bigint_t slice(const bigint_t & a, size_t low, size_t high)
+{
+    bigint_t result;
+
+    low  = std::min(low,  a.limb.size());
+    high = std::min(high, a.limb.size());
+    result.limb.assign(a.limb.begin() + low, a.limb.begin() + high);
+    normalize(result);
+
+    return result;
+}
+
+bigint_t mul(const bigint_t & a, const bigint_t & b)
+{
+    size_t na = a.limb.size(), nb = b.limb.size();
+    bigint_t result;
+
+    if (na == 0 || nb == 0)
+        return result;
+
+    // operand kecil: schoolbook
+    if (std::min(na, nb) < KARATSUBA_THRESHOLD)
+    {
+        result.limb.assign(na + nb, 0);
+        if (na >= nb)
+            mul_schoolbook(a.limb.data(), na, b.limb.data(), nb, result.limb.data());
+        else
+            mul_schoolbook(b.limb.data(), nb, a.limb.data(), na, result.limb.data());
+        normalize(result);
+        return result;
+    }
+
+    // operand tidak seimbang: potong operand panjang seukuran operand pendek
+    if (2 * std::min(na, nb) <= std::max(na, nb))
+    {
+        const bigint_t & lng = (na > nb) ? a : b;
+        const bigint_t & sht = (na > nb) ? b : a;
+        size_t step = sht.limb.size();
+
+        for (size_t i = 0; i < lng.limb.size(); i += step)
+            add_shifted(result, mul(slice(lng, i, i + step), sht), i);
+
+        normalize(result);
+        return result;
+    }
+
+    // karatsuba
+    size_t m = std::max(na, nb) / 2;
+
+    bigint_t a0 = slice(a, 0, m), a1 = slice(a, m, na);
+    bigint_t b0 = slice(b, 0, m), b1 = slice(b, m, nb);
+
+    bigint_t z0 = mul(a0, b0);
+    bigint_t z2 = mul(a1, b1);
+    bigint_t z1 = mul(add(a0, a1), add(b0, b1));
+    sub_inplace(z1, z0);
+    sub_inplace(z1, z2);
+
+    result = z0;
+    add_shifted(result, z1, m);
+    add_shifted(result, z2, 2 * m);
+    normalize(result);
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Perkalian banyak bilangan (product tree) **/
+
+/*
+    Menghitung arr[low] * arr[low + 1] * ... * arr[high - 1].
+    Operand dipasangkan secara seimbang sehingga karatsuba bekerja pada operand dengan
+    ukuran yang mirip.
+*/
+bigint_t product(const std::vector<uint64_t> & arr, size_t low, size_t high)
+{
+    if (high - low <= 16)
+    {
+        bigint_t result(1);
+        for (size_t i = low; i < high; i++)
+            mul_small(result, arr[i]);
+        return result;
+    }
+
+    size_t mid = low + (high - low) / 2;
+    return mul(product(arr, low, mid), product(arr, mid, high));
+}
+
+// ======================================================================================
+
+/** Konversi ke string desimal **/
+
+std::string to_string(bigint_t a)
+{
+    if (a.is_zero())
+        return "0";
+
+    // ambil 19 digit desimal sekaligus
+    const uint64_t BASE = 10000000000000000000ULL;
+    std::vector<uint64_t> chunks;
+
+    while (! a.is_zero())
+        chunks.push_back(div_small(a, BASE));
+
+    std::string result = std::to_string(chunks.back());
+    for (size_t i = chunks.size() - 1; i-- > 0; )
+    {
+        std::string part = std::to_string(chunks[i]);
+        result += std::string(19 - part.size(), '0') + part;
+    }
+
+    return result;
+}
\ No newline at end of file
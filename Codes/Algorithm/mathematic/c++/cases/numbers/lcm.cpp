@@ -17,6 +17,9 @@ Run:
     $ lcm
 */
 #include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <thread>
 
 /*
 LCM (Least Common Multiple) atau KPK (Kelipatan Persekutuan terKecil)
@@ -98,4 +101,123 @@ size_t algorithm(size_t num_1, size_t num_2)
     auto value = gcd(num_1, num_2);
 
     return (num_1 * num_2) / value;
+}
+
+// ======================================================================================
+
+/*
+    Checked Solution
+    Solusi persamaan di atas mengalikan num_1 * num_2 sebelum membagi sehingga overflow
+    untuk bilangan di atas 2^32 meskipun hasil LCM masih muat.
+
+    Bagi terlebih dahulu, lalu kalikan dengan perkalian 128-bit:
+
+        LCM = (num_1 / GCD) * num_2
+
+    Fungsi mengembalikan false bila hasil tidak muat di 64-bit.
+*/
+
+// Mencari GCD. Lihat di bagian GCD (Binary GCD)
+size_t gcd(size_t num_1, size_t num_2);
+
+bool algorithm(size_t num_1, size_t num_2, size_t & value)
+{
+    if (num_1 == 0 || num_2 == 0)
+    {
+        value = 0;
+        return true;
+    }
+
+    unsigned __int128 product = (unsigned __int128) (num_1 / gcd(num_1, num_2)) * num_2;
+
+    value = (size_t) product;
+    return (product >> 64) == 0;
+}
+
+// ======================================================================================
+
+/*
+    Saturating Solution
+    Seperti di atas, namun hasil yang overflow dipotong menjadi SIZE_MAX. Berguna untuk
+    reduksi array: setelah saturasi, seluruh hasil berikutnya juga SIZE_MAX, kecuali
+    bila bertemu 0 (LCM dengan 0 selalu 0).
+
+    LCM yang memang bernilai tepat SIZE_MAX tidak dapat dibedakan dari saturasi.
+*/
+
+// Mencari GCD. Lihat di bagian GCD (Binary GCD)
+size_t gcd(size_t num_1, size_t num_2);
+
+size_t algorithm(size_t num_1, size_t num_2)
+{
+    if (num_1 == 0 || num_2 == 0)
+        return 0;
+
+    // LCM(SIZE_MAX, x) >= SIZE_MAX, pasti saturasi
+    if (num_1 == SIZE_MAX || num_2 == SIZE_MAX)
+        return SIZE_MAX;
+
+    size_t value;
+    if (__builtin_mul_overflow(num_1 / gcd(num_1, num_2), num_2, &value))
+        return SIZE_MAX;
+
+    return value;
+}
+
+// ======================================================================================
+
+/*
+    Parallel Reduction
+    Mencari LCM dari seluruh elemen array dengan saturating LCM di atas.
+
+    Array dibagi menjadi beberapa bagian yang direduksi oleh thread berbeda, kemudian
+    hasil tiap thread direduksi kembali. Reduksi berhenti lebih awal bila bertemu 0. Setelah
+    hasil sementara saturasi, sisa elemen hanya diperiksa apakah bernilai 0. Hasil
+    SIZE_MAX menandakan LCM tidak muat di 64-bit.
+*/
+
+// Saturating LCM. Lihat di bagian atas
+size_t lcm(size_t num_1, size_t num_2);
+
+size_t reduce(const size_t arr[], size_t low, size_t high)
+{
+    size_t value = 1;
+
+    for (size_t i = low; i < high; i++)
+    {
+        if (arr[i] == 0)
+            return 0;
+        if (value != SIZE_MAX)
+            value = lcm(value, arr[i]);
+    }
+
+    return value;
+}
+
+size_t algorithm(const size_t arr[], size_t N)
+{
+    size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+    size_t chunk    = (N + nthreads - 1) / nthreads;
+
+    // input kecil tidak sebanding dengan biaya pembuatan thread
+    if (nthreads == 1 || N < 4096)
+        return reduce(arr, 0, N);
+
+    std::vector<size_t>      partial(nthreads, 1);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < nthreads; t++)
+    {
+        size_t low  = std::min(N, t * chunk);
+        size_t high = std::min(N, low + chunk);
+
+        workers.emplace_back([&, t, low, high] {
+            partial[t] = reduce(arr, low, high);
+        });
+    }
+
+    for (auto & w : workers)
+        w.join();
+
+    return reduce(partial.data(), 0, nthreads);
 }
\ No newline at end of file
@@ -0,0 +1,328 @@
+/*
+    Modular Arithmetic
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Numbers)
+
+Compile:
+    [clang]
+    $ clang++ -std=c++17 modular-arithmetic.cpp -o modular-arithmetic
+
+    [gcc]
+    $ g++ -std=c++17 modular-arithmetic.cpp -o modular-arithmetic
+
+    [msvc]
+    $ cl /std:c++17 modular-arithmetic.cpp
+
+Run:
+    $ modular-arithmetic
+*/
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+/*
+    Kumpulan operasi aritmetika modular.
+
+    Perhitungan (a * b) % m dengan uint64_t akan overflow bila m > 2^32 dan setiap
+    operasi % membutuhkan instruksi pembagian hardware (20-90 cycle).
+
+    - modint_t<M>   modulus diketahui saat kompilasi (M < 2^31). Karena M konstan,
+                    compiler mengganti % dengan perkalian dan shift (Barrett reduction)
+                    sehingga tidak ada instruksi pembagian. Dapat digunakan di constexpr.
+    - montgomery_t  modulus ganjil < 2^63 yang baru diketahui saat runtime. Perkalian
+                    dilakukan di Montgomery form sehingga reduksi hanya membutuhkan
+                    perkalian 64-bit.
+
+    Di atasnya dibangun: modpow, modular inverse, batch inversion, dan NTT (Number
+    Theoretic Transform) untuk perkalian polinom.
+*/
+
+// ======================================================================================
+
+/** Compile-time Modulus **/
+
+template <uint32_t M>
+struct modint_t
+{
+    uint32_t v;
+
+    constexpr modint_t(uint64_t x = 0) : v(x % M) {}
+
+    // bentuk dari nilai yang dipastikan sudah < M
+    static constexpr modint_t raw(uint32_t x)
+    {
+        modint_t r;
+        r.v = x;
+        return r;
+    }
+
+    constexpr modint_t operator+(modint_t b) const
+    {
+        uint32_t s = v + b.v;
+        return raw(s >= M ? s - M : s);
+    }
+
+    constexpr modint_t operator-(modint_t b) const
+    {
+        return raw(v >= b.v ? v - b.v : v + M - b.v);
+    }
+
+    constexpr modint_t operator*(modint_t b) const
+    {
+        return raw((uint64_t) v * b.v % M);
+    }
+
+    constexpr modint_t & operator+=(modint_t b) { return *this = *this + b; }
+    constexpr modint_t & operator-=(modint_t b) { return *this = *this - b; }
+    constexpr modint_t & operator*=(modint_t b) { return *this = *this * b; }
+
+    constexpr bool operator==(modint_t b) const { return v == b.v; }
+
+    // perpangkatan dengan binary exponentiation
+    constexpr modint_t pow(uint64_t exp) const
+    {
+        modint_t result(1), base = *this;
+
+        while (exp > 0)
+        {
+            if (exp & 1)
+                result *= base;
+
+            exp  >>= 1;
+            base *= base;
+        }
+
+        return result;
+    }
+
+    // invers dengan Fermat's little theorem, hanya berlaku bila M prima
+    constexpr modint_t inv() const
+    {
+        return pow(M - 2);
+    }
+};
+
+// ======================================================================================
+
+/** Runtime Modulus -- Montgomery Reduction **/
+
+/*
+    Nilai x disimpan sebagai x * R mod m dengan R = 2^64.
+    Reduksi REDC(t) = t * R^-1 mod m hanya membutuhkan perkalian:
+
+        q = (t mod R) * m^-1 mod R
+        REDC(t) = (t - q * m) / R       (pengurangan ini selalu habis dibagi R)
+
+    Syarat: m ganjil dan m < 2^63.
+*/
+
+struct montgomery_t
+{
+    uint64_t mod;
+    uint64_t inv;       // m^-1 mod 2^64
+    uint64_t r2;        // 2^128 mod m
+
+    montgomery_t(uint64_t m) : mod(m)
+    {
+        // Newton iteration: setiap langkah menggandakan bit yang benar
+        inv = m;
+        for (int i = 0; i < 5; i++)
+            inv *= 2 - m * inv;
+
+        uint64_t r = (0 - m) % m;       // 2^64 mod m
+        r2 = (unsigned __int128) r * r % m;
+    }
+
+    uint64_t reduce(unsigned __int128 t) const
+    {
+        uint64_t q  = (uint64_t) t * inv;
+        uint64_t hi = (uint64_t) (t >> 64);
+        uint64_t qm = (uint64_t) (((unsigned __int128) q * mod) >> 64);
+
+        return (hi >= qm) ? hi - qm : hi - qm + mod;
+    }
+
+    uint64_t to_mont(uint64_t x) const      { return reduce((unsigned __int128) x * r2); }
+    uint64_t from_mont(uint64_t x) const    { return reduce(x); }
+
+    // a dan b dalam Montgomery form
+    uint64_t mul(uint64_t a, uint64_t b) const
+    {
+        return reduce((unsigned __int128) a * b);
+    }
+
+    // base dan hasil dalam bentuk biasa
+    uint64_t pow(uint64_t base, uint64_t exp) const
+    {
+        uint64_t result = to_mont(1);
+
+        base = to_mont(base % mod);
+        while (exp > 0)
+        {
+            if (exp & 1)
+                result = mul(result, base);
+
+            exp  >>= 1;
+            base = mul(base, base);
+        }
+
+        return from_mont(result);
+    }
+};
+
+// ======================================================================================
+
+/** Modular Inverse -- Extended Euclid **/
+
+/*
+    Mencari x sehingga (a * x) mod m = 1. Berlaku untuk sembarang m (tidak harus prima)
+    selama gcd(a, m) = 1. Mengembalikan 0 bila invers tidak ada.
+*/
+
+uint64_t inverse(uint64_t a, uint64_t m)
+{
+    int64_t  t = 0, new_t = 1;
+    uint64_t r = m, new_r = a % m;
+
+    while (new_r != 0)
+    {
+        uint64_t q = r / new_r;
+
+        int64_t  tmp_t = t - (int64_t) q * new_t;
+        t = new_t; new_t = tmp_t;
+
+        uint64_t tmp_r = r - q * new_r;
+        r = new_r; new_r = tmp_r;
+    }
+
+    if (r != 1)
+        return 0;
+
+    return (t < 0) ? t + m : t;
+}
+
+// ======================================================================================
+
+/** Batch Inversion **/
+
+/*
+    Montgomery's trick: invers dari N bilangan hanya dengan satu operasi invers dan
+    3(N - 1) perkalian.
+
+        prefix[i] = arr[0] * arr[1] * ... * arr[i]
+        inv(arr[i]) = prefix[i - 1] * inv(prefix[i])
+
+    Semua elemen harus memiliki invers (tidak bernilai 0).
+*/
+
+template <uint32_t M>
+void batch_inverse(modint_t<M> arr[], size_t N)
+{
+    if (N == 0)
+        return;
+
+    std::vector<modint_t<M>> prefix(N);
+
+    prefix[0] = arr[0];
+    for (size_t i = 1; i < N; i++)
+        prefix[i] = prefix[i - 1] * arr[i];
+
+    // invers dari seluruh perkalian, lalu kupas satu per satu dari belakang
+    modint_t<M> acc = prefix[N - 1].inv();
+    for (size_t i = N - 1; i > 0; i--)
+    {
+        modint_t<M> inv_i = acc * prefix[i - 1];
+        acc   *= arr[i];
+        arr[i] = inv_i;
+    }
+    arr[0] = acc;
+}
+
+// ======================================================================================
+
+/** Number Theoretic Transform **/
+
+/*
+    FFT di atas field Z/MZ. M harus berbentuk c * 2^k + 1 dengan 2^k >= ukuran transform,
+    dan G merupakan primitive root dari M. Contoh: 998244353 = 119 * 2^23 + 1, G = 3.
+
+    Transform bersifat eksak (tidak ada error floating point) dan perkalian polinom
+    berderajat n dapat dilakukan dalam O(n log n).
+*/
+
+const uint32_t NTT_MOD  = 998244353;
+const uint32_t NTT_ROOT = 3;
+
+using mint = modint_t<NTT_MOD>;
+
+void ntt(std::vector<mint> & a, bool invert)
+{
+    size_t n = a.size();
+
+    // permutasi bit-reversal
+    for (size_t i = 1, j = 0; i < n; i++)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+            std::swap(a[i], a[j]);
+    }
+
+    // butterfly dengan panjang 2, 4, 8, ..., n
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        mint w = mint(NTT_ROOT).pow((NTT_MOD - 1) / len);
+        if (invert)
+            w = w.inv();
+
+        for (size_t i = 0; i < n; i += len)
+        {
+            mint wn(1);
+            for (size_t j = 0; j < len / 2; j++)
+            {
+                mint u = a[i + j];
+                mint v = a[i + j + len / 2] * wn;
+
+                a[i + j]           = u + v;
+                a[i + j + len / 2] = u - v;
+                wn *= w;
+            }
+        }
+    }
+
+    if (invert)
+    {
+        mint n_inv = mint(n).inv();
+        for (auto & x : a)
+            x *= n_inv;
+    }
+}
+
+// perkalian polinom: koefisien hasil modulo NTT_MOD
+std::vector<mint> multiply(std::vector<mint> a, std::vector<mint> b)
+{
+    if (a.empty() || b.empty())
+        return {};
+
+    size_t size = a.size() + b.size() - 1;
+    size_t n    = 1;
+    while (n < size)
+        n <<= 1;
+
+    a.resize(n);
+    b.resize(n);
+    ntt(a, false);
+    ntt(b, false);
+
+    for (size_t i = 0; i < n; i++)
+        a[i] *= b[i];
+
+    ntt(a, true);
+    a.resize(size);
+
+    return a;
+}
\ No newline at end of file
@@ -103,4 +103,18 @@ size_t algorithm(size_t N)
 
     // ketika berakhir, telah dibangkitkan N - 1 bilangna
     return next_ugly;
-}
\ No newline at end of file
+}
+
+// ======================================================================================
+
+/* 
+    Iterative Solution
+    N-th Term Generator -- Shared Smooth Number Generator
+    Bangkitkan suku ke-N dari Ugly Number
+*/
+
+/*
+    Bilangan dapat dibangkitkan secara streaming tanpa menyimpan seluruh N bilangan
+    dengan generator heap yang sama dengan Super Ugly Numbers (faktor {2, 3, 5}).
+    Lihat di bagian Ugly Numbers (dynamic-programming/c++/cases/ugly-numbers.cpp)
+*/
\ No newline at end of file
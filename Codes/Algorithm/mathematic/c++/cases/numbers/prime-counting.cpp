@@ -0,0 +1,471 @@
+/*
+    Prime Counting Function
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Numbers)
+
+Compile:
+    [clang]
+    $ clang++ -O2 -pthread prime-counting.cpp -o prime-counting
+
+    [gcc]
+    $ g++ -O2 -pthread prime-counting.cpp -o prime-counting
+
+    [msvc]
+    $ cl /O2 prime-counting.cpp
+
+Run:
+    $ prime-counting
+*/
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+/*
+    Prime Counting Function, pi(x), adalah banyaknya bilangan prima yang bernilai lebih
+    kecil atau sama dengan x.
+
+    Cara paling sederhana adalah membangkitkan semua bilangan prima dengan sieve lalu
+    menghitung ukuran hasilnya. Cara ini membutuhkan memori O(x) sehingga tidak praktis
+    untuk x di atas 1e10.
+
+    Contoh:
+        pi(10)   = 4
+        pi(1e9)  = 50847534
+        pi(1e12) = 37607912018
+*/
+
+// ======================================================================================
+
+/*
+    Fungsi pembantu yang digunakan oleh semua solusi di bawah.
+*/
+
+// bangkitkan semua bilangan prima <= N (sieve of eratosthenes sederhana)
+std::vector<uint32_t> small_primes(uint64_t N)
+{
+    std::vector<uint32_t> primes;
+    std::vector<char>     marks(N + 1, true);
+
+    for (uint64_t p = 2; p <= N; p++)
+    {
+        if (! marks[p])
+            continue;
+
+        primes.push_back(p);
+        for (uint64_t i = p * p; i <= N; i += p)
+            marks[i] = false;
+    }
+
+    return primes;
+}
+
+// akar kuadrat dan akar pangkat tiga yang tepat untuk bilangan bulat 64-bit
+uint64_t isqrt(uint64_t x)
+{
+    uint64_t r = sqrtl((long double) x);
+    while (r * r > x)               r--;
+    while ((r + 1) * (r + 1) <= x)  r++;
+    return r;
+}
+
+uint64_t icbrt(uint64_t x)
+{
+    uint64_t r = cbrtl((long double) x);
+    while (r * r * r > x)                   r--;
+    while ((r + 1) * (r + 1) * (r + 1) <= x) r++;
+    return r;
+}
+
+// ======================================================================================
+
+/*
+    Segmented Sieve Counter
+    Hitung bilangan prima di rentang [low, high) tanpa menyimpan bilangan prima.
+
+    Hanya bilangan ganjil yang disimpan (satu byte untuk setiap bilangan ganjil) dan
+    sieve dilakukan per segmen sehingga data segmen selalu berada di cache L2.
+
+    primes harus memuat semua bilangan prima <= sqrt(high).
+    targets (terurut menaik, di dalam [low, high)) diisi dengan jumlah bilangan prima
+    di rentang [low, targets[i]] pada counts[i].
+*/
+
+const uint64_t SEGMENT_SIZE = 1 << 18;
+
+uint64_t count_segment(const std::vector<uint32_t> & primes, uint64_t low, uint64_t high,
+    const uint64_t targets[] = nullptr, uint64_t counts[] = nullptr, size_t ntargets = 0)
+{
+    std::vector<uint8_t> marks(SEGMENT_SIZE);
+    uint64_t total = 0;
+    size_t   t = 0;
+
+    // 2 merupakan satu-satunya bilangan prima genap
+    if (low <= 2 && 2 < high)
+        total ++;
+
+    // mulai dari bilangan ganjil pertama
+    for (uint64_t seg = low | 1; seg < high; seg += 2 * SEGMENT_SIZE)
+    {
+        uint64_t seg_end = std::min(high, seg + 2 * SEGMENT_SIZE);
+        uint64_t size    = (seg_end - seg + 1) / 2;
+
+        memset(marks.data(), 1, size);
+
+        // tandai kelipatan ganjil dari setiap bilangan prima ganjil
+        for (size_t i = 1; i < primes.size(); i++)
+        {
+            uint64_t p  = primes[i];
+            uint64_t p2 = p * p;
+            if (p2 >= seg_end)
+                break;
+
+            uint64_t start = std::max(p2, ((seg + p - 1) / p) * p);
+            if ((start & 1) == 0)
+                start += p;
+
+            for (uint64_t j = (start - seg) / 2; j < size; j += p)
+                marks[j] = 0;
+        }
+
+        // 1 bukan bilangan prima
+        if (seg == 1)
+            marks[0] = 0;
+
+        // hitung jumlah bilangan yang tidak ditandai sekaligus menjawab target
+        for (uint64_t j = 0; j < size; j++)
+        {
+            while (t < ntargets && targets[t] < seg + 2 * j)
+                counts[t++] = total;
+            total += marks[j];
+        }
+    }
+
+    // target yang berada setelah bilangan ganjil terakhir
+    while (t < ntargets)
+        counts[t++] = total;
+
+    return total;
+}
+
+// ======================================================================================
+
+/** Iterative Solution -- Parallel Segmented Sieve Counting **/
+
+/*
+    Baseline berbasis sieve. Rentang [0, x] dibagi menjadi beberapa bagian yang sama
+    besar dan tiap bagian dihitung oleh thread berbeda.
+
+    Memori O(sqrt(x)), waktu O(x log log x).
+*/
+
+uint64_t algorithm(uint64_t x)
+{
+    if (x < 2)
+        return 0;
+
+    auto primes = small_primes(isqrt(x));
+
+    size_t   nthreads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t chunk    = (x + nthreads) / nthreads + 1;
+    std::vector<uint64_t>    partial(nthreads, 0);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < nthreads; t++)
+    {
+        uint64_t low  = t * chunk;
+        uint64_t high = std::min(x + 1, low + chunk);
+
+        if (low >= high)
+            break;
+
+        workers.emplace_back([&, t, low, high] {
+            partial[t] = count_segment(primes, low, high);
+        });
+    }
+
+    for (auto & w : workers)
+        w.join();
+
+    uint64_t result = 0;
+    for (auto c : partial)
+        result += c;
+
+    return result;
+}
+
+// ======================================================================================
+
+/** Meissel-Lehmer **/
+
+/*
+    Formula Meissel:
+
+        pi(x) = phi(x, a) + a - 1 - P2(x, a)
+
+    dengan
+        a        = pi(x^(1/3))
+        phi(x,a) = banyaknya bilangan <= x yang tidak habis dibagi a bilangan prima pertama
+        P2(x,a)  = banyaknya bilangan <= x yang merupakan perkalian tepat dua bilangan
+                   prima lebih besar dari p[a]
+                 = sum (pi(x / p[i]) - i + 1)  untuk a < i <= pi(sqrt(x))
+
+    phi(x, a) dihitung secara rekursif dengan identitas
+
+        phi(x, a) = phi(x, a - 1) - phi(x / p[a], a - 1)
+
+    dengan beberapa jalan pintas:
+    - phi(x, c) untuk c kecil diambil dari tabel berperiode p1 * p2 * ... * pc
+    - jika x < p[a + 1]^2 maka phi(x, a) = pi(x) - a + 1
+
+    Percabangan teratas dari phi dibagi ke beberapa thread. Nilai pi(x / p[i]) untuk
+    P2 didapatkan dari segmented sieve counter di atas, juga dibagi per thread.
+
+    Sieve untuk P2 berjalan hingga x^(2/3), memori O(x^(1/2)).
+*/
+
+/*
+    Tabel pi(n) untuk n <= limit dengan bit-packing.
+    Setiap word 64-bit menyimpan status 128 bilangan (hanya bilangan ganjil), disertai
+    jumlah prima sebelum word tersebut. Membutuhkan sekitar 12 byte per 128 bilangan.
+*/
+struct pi_table_t
+{
+    std::vector<uint64_t> bits;
+    std::vector<uint32_t> count;
+    uint64_t limit;
+
+    pi_table_t(const std::vector<uint32_t> & primes, uint64_t limit) : limit(limit)
+    {
+        bits.assign(limit / 128 + 1, 0);
+        count.assign(limit / 128 + 1, 0);
+
+        // primes[1] = 2 tidak disimpan karena hanya bilangan ganjil yang dicatat
+        for (size_t i = 2; i < primes.size() && primes[i] <= limit; i++)
+            bits[primes[i] / 128] |= 1ULL << ((primes[i] % 128) / 2);
+
+        for (size_t i = 1; i < bits.size(); i++)
+            count[i] = count[i - 1] + __builtin_popcountll(bits[i - 1]);
+    }
+
+    uint64_t operator()(uint64_t n) const
+    {
+        if (n < 2)
+            return 0;
+
+        // sisakan bit untuk bilangan ganjil <= n, tambahkan 1 untuk bilangan prima 2
+        uint64_t odd  = (n % 128 + 1) / 2;
+        uint64_t mask = (odd == 64) ? ~0ULL : (1ULL << odd) - 1;
+
+        return 1 + count[n / 128] + __builtin_popcountll(bits[n / 128] & mask);
+    }
+};
+
+/*
+    Tabel phi(x, c) untuk c <= PHI_C.
+    phi(x, c) = (x / pp) * phi(pp) + phi(x % pp), pp = p1 * p2 * ... * pc
+*/
+const size_t PHI_C = 6;
+
+struct phi_tiny_t
+{
+    uint64_t prod[PHI_C + 1];
+    std::vector<uint32_t> table[PHI_C + 1];
+
+    phi_tiny_t()
+    {
+        const uint32_t p[] = {1, 2, 3, 5, 7, 11, 13};
+
+        prod[0] = 1;
+        table[0] = {0};
+        for (size_t c = 1; c <= PHI_C; c++)
+        {
+            prod[c] = prod[c - 1] * p[c];
+            table[c].resize(prod[c]);
+
+            uint32_t total = 0;
+            for (uint64_t n = 0; n < prod[c]; n++)
+            {
+                bool coprime = (n != 0);
+                for (size_t i = 1; i <= c && coprime; i++)
+                    coprime = (n % p[i] != 0);
+
+                // table[c][n] = phi(n, c)
+                total += coprime;
+                table[c][n] = total;
+            }
+        }
+    }
+
+    uint64_t operator()(uint64_t x, size_t c) const
+    {
+        if (c == 0)
+            return x;
+
+        return (x / prod[c]) * table[c][prod[c] - 1] + table[c][x % prod[c]];
+    }
+};
+
+// primes 1-indexed: primes[1] = 2, primes[2] = 3, ...
+int64_t phi(uint64_t x, size_t a, const std::vector<uint32_t> & primes,
+    const pi_table_t & pi, const phi_tiny_t & tiny)
+{
+    if (x == 0)
+        return 0;
+
+    if (a <= PHI_C)
+        return tiny(x, a);
+
+    // hanya 1 yang tersisa
+    if (x < primes[a])
+        return 1;
+
+    // semua bilangan komposit <= x memiliki faktor prima <= p[a]
+    if (x <= pi.limit && x < (uint64_t) primes[a + 1] * primes[a + 1])
+        return pi(x) - a + 1;
+
+    int64_t sum = tiny(x, PHI_C);
+    for (size_t i = PHI_C + 1; i <= a; i++)
+    {
+        uint64_t xp = x / primes[i];
+
+        // phi(xp, i - 1) = 1 untuk semua i berikutnya dengan p[i] <= x
+        if (xp < primes[i])
+        {
+            size_t last = (x <= pi.limit) ? std::min<uint64_t>(a, pi(x)) : a;
+            if (last >= i)
+                sum -= last - i + 1;
+            break;
+        }
+
+        sum -= phi(xp, i - 1, primes, pi, tiny);
+    }
+
+    return sum;
+}
+
+// phi(x, a) dengan percabangan teratas dibagi ke beberapa thread
+int64_t parallel_phi(uint64_t x, size_t a, const std::vector<uint32_t> & primes,
+    const pi_table_t & pi, const phi_tiny_t & tiny)
+{
+    if (a <= PHI_C)
+        return tiny(x, a);
+
+    size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+    std::atomic<size_t>      next(PHI_C + 1);
+    std::vector<int64_t>     partial(nthreads, 0);
+    std::vector<std::thread> workers;
+
+    /*
+    phi(x, a) = phi(x, c) - sum phi(x / p[i], i - 1) untuk c < i <= a
+    Cabang dengan i kecil jauh lebih mahal sehingga pembagian dilakukan secara dinamis.
+    */
+    for (size_t t = 0; t < nthreads; t++)
+    {
+        workers.emplace_back([&, t] {
+            size_t i;
+            while ((i = next++) <= a)
+                partial[t] -= phi(x / primes[i], i - 1, primes, pi, tiny);
+        });
+    }
+
+    for (auto & w : workers)
+        w.join();
+
+    int64_t sum = tiny(x, PHI_C);
+    for (auto s : partial)
+        sum += s;
+
+    return sum;
+}
+
+// P2(x, a): pi(x / p[i]) untuk semua i dihitung dalam satu pass segmented sieve
+int64_t P2(uint64_t x, size_t a, size_t b, const std::vector<uint32_t> & primes)
+{
+    if (b <= a)
+        return 0;
+
+    // target terurut menaik: x / p[b], x / p[b - 1], ..., x / p[a + 1]
+    std::vector<uint64_t> targets;
+    for (size_t i = b; i > a; i--)
+        targets.push_back(x / primes[i]);
+
+    uint64_t low  = 0;
+    uint64_t high = targets.back() + 1;
+
+    // bilangan prima untuk sieve hingga x / p[a + 1]
+    auto sieving = small_primes(isqrt(high));
+
+    size_t   nthreads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t chunk    = (high - low + nthreads - 1) / nthreads;
+    std::vector<uint64_t>    counts(targets.size());
+    std::vector<uint64_t>    totals(nthreads, 0);
+    std::vector<size_t>      first(nthreads + 1, targets.size());
+    std::vector<std::thread> workers;
+
+    // setiap thread menjawab target di dalam rentangnya sendiri
+    for (size_t t = 0; t < nthreads; t++)
+    {
+        uint64_t lo = low + t * chunk;
+        uint64_t hi = std::min(high, lo + chunk);
+
+        first[t] = std::lower_bound(targets.begin(), targets.end(), lo) - targets.begin();
+        if (lo >= hi)
+            continue;
+
+        size_t f = first[t];
+        size_t l = std::lower_bound(targets.begin(), targets.end(), hi) - targets.begin();
+
+        workers.emplace_back([&, t, lo, hi, f, l] {
+            totals[t] = count_segment(sieving, lo, hi,
+                targets.data() + f, counts.data() + f, l - f);
+        });
+    }
+
+    for (auto & w : workers)
+        w.join();
+
+    // gabungkan hitungan lokal dengan prefix sum dari thread sebelumnya
+    uint64_t prefix = 0;
+    for (size_t t = 0; t < nthreads; t++)
+    {
+        size_t end = (t + 1 < nthreads) ? first[t + 1] : targets.size();
+        for (size_t k = first[t]; k < end; k++)
+            counts[k] += prefix;
+        prefix += totals[t];
+    }
+
+    int64_t sum = 0;
+    for (size_t k = 0; k < targets.size(); k++)
+    {
+        size_t i = b - k;
+        sum += (int64_t) counts[k] - (int64_t) i + 1;
+    }
+
+    return sum;
+}
+
+uint64_t algorithm(uint64_t x)
+{
+    if (x < 2)
+        return 0;
+
+    uint64_t sqrtx = isqrt(x);
+    uint64_t cbrtx = icbrt(x);
+
+    // bilangan prima hingga sqrt(x) dengan indeks mulai dari 1
+    auto primes = small_primes(sqrtx + 1);
+    primes.insert(primes.begin(), 0);
+    primes.push_back(UINT32_MAX);
+
+    pi_table_t pi(primes, sqrtx);
+    phi_tiny_t tiny;
+
+    size_t a = pi(cbrtx);
+    size_t b = pi(sqrtx);
+
+    return parallel_phi(x, a, primes, pi, tiny) + a - 1 - P2(x, a, b, primes);
+}
\ No newline at end of file
@@ -18,6 +18,10 @@ Run:
 */
 #include <vector>
 #include <cmath>
+#include <cstdint>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 /*
     Penggunaan Sieve of Atkin untuk membangkitkan bilangan prima.
@@ -98,5 +102,191 @@ auto algorithm(size_t N)
             primes.push_back(i);
     }
 
+    return primes;
+}
+
+// ======================================================================================
+
+/*
+    Segmented Sieve of Atkin
+    Bangkitkan semua bilangan prima yang bernilai lebih kecil atau sama dengan N.
+
+    Versi di atas mengiterasi seluruh pasangan (X, Y) terhadap satu array sebesar N
+    sehingga terikat oleh bandwidth memori. Versi ini memproses rentang [0, N] per
+    segmen dengan ukuran tetap (muat di cache L2):
+
+    - hanya bilangan ganjil yang disimpan, satu bit per bilangan (bit-packing).
+    - untuk setiap segmen [L, R) dan setiap X, rentang Y dihitung langsung sehingga
+      hanya titik lattice yang jatuh di segmen yang dikunjungi.
+    - pemilihan bentuk kuadrat berdasarkan sisa bagi 60:
+        4x^2 + y^2  untuk R = 1, 13, 17, 29, 37, 41, 49, 53
+        3x^2 + y^2  untuk R = 7, 19, 31, 43
+        3x^2 - y^2  untuk R = 11, 23, 47, 59  (dengan x > y)
+      kelipatan 2, 3, dan 5 otomatis tidak pernah ditandai.
+    - setiap segmen independen sehingga dapat dibagi ke beberapa thread.
+
+    Bilangan prima kecil (<= sqrt(N)) untuk penghapusan kelipatan kuadrat dibangkitkan
+    dengan sieve biasa.
+
+    Catatan: pada N hingga ~1e9 segmented sieve of eratosthenes dengan wheel biasanya
+    masih sedikit lebih cepat; Atkin unggul pada rentang yang lebih besar karena jumlah
+    operasinya O(N) bukan O(N log log N).
+*/
+
+// sieve of eratosthenes sederhana. Lihat di bagian Sieve of Eratosthenes
+std::vector<size_t> sieve(size_t N);
+
+// bentuk kuadrat yang berlaku untuk setiap sisa bagi 60 (0 berarti diabaikan)
+static const uint8_t atkin_form[60] = {
+    0, 1, 0, 0, 0, 0, 0, 2, 0, 0,  0, 3, 0, 1, 0, 0, 0, 1, 0, 2,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 1,  0, 2, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 1, 0, 2, 0, 0, 0, 3, 0, 1,  0, 0, 0, 1, 0, 0, 0, 0, 0, 3
+};
+
+const size_t ATKIN_SEGMENT = 1 << 20;   // banyaknya bilangan per segmen
+
+// akar kuadrat bulat dibulatkan ke atas
+static inline size_t ceil_sqrt(size_t n)
+{
+    size_t r = sqrt((double) n);
+    while (r * r < n)                   r++;
+    while (r > 0 && (r - 1) * (r - 1) >= n) r--;
+    return r;
+}
+
+// proses satu segmen [L, R) dengan L genap, hasil bilangan prima ke dalam out
+void atkin_segment(size_t L, size_t R, const std::vector<size_t> & small,
+    std::vector<size_t> & out)
+{
+    // bit ke-j menyatakan bilangan L + 2j + 1
+    std::vector<uint64_t> bits(((R - L) / 2 + 63) / 64, 0);
+
+    auto flip = [&](size_t n) {
+        size_t j = (n - L) / 2;
+        bits[j >> 6] ^= 1ULL << (j & 63);
+    };
+
+    // 4x^2 + y^2, y ganjil
+    for (size_t x = 1; 4 * x * x < R; x++)
+    {
+        size_t base = 4 * x * x;
+        size_t y    = (base < L) ? ceil_sqrt(L - base) : 1;
+        y |= 1;
+        for (size_t n = base + y * y; n < R; y += 2, n = base + y * y)
+            if (atkin_form[n % 60] == 1)
+                flip(n);
+    }
+
+    // 3x^2 + y^2, paritas y berlawanan dengan x
+    for (size_t x = 1; 3 * x * x < R; x++)
+    {
+        size_t base = 3 * x * x;
+        size_t y    = (base < L) ? ceil_sqrt(L - base) : 1;
+        if ((y & 1) == (x & 1))
+            y++;
+        for (size_t n = base + y * y; n < R; y += 2, n = base + y * y)
+            if (atkin_form[n % 60] == 2)
+                flip(n);
+    }
+
+    // 3x^2 - y^2 dengan x > y, paritas y berlawanan dengan x
+    for (size_t x = 2; 2 * x * x + 2 * x - 1 < R; x++)
+    {
+        size_t base = 3 * x * x;
+        if (base - 1 < L)
+            continue;
+
+        // y terbesar sehingga 3x^2 - y^2 >= L
+        size_t y = std::min(x - 1, (size_t) sqrt((double) (base - L)));
+        while (y * y > base - L) y--;
+        if ((y & 1) == (x & 1))
+            y--;
+
+        for (; y < x; y -= 2)
+        {
+            size_t n = base - y * y;
+            if (n >= R)
+                break;
+            if (atkin_form[n % 60] == 3)
+                flip(n);
+        }
+    }
+
+    // hapus kelipatan kuadrat bilangan prima (p >= 7)
+    for (size_t p : small)
+    {
+        size_t p2 = p * p;
+        if (p < 7)
+            continue;
+        if (p2 >= R)
+            break;
+
+        // kelipatan ganjil dari p^2 di segmen
+        size_t n = std::max(p2, ((L + p2 - 1) / p2) * p2);
+        if ((n & 1) == 0)
+            n += p2;
+        for (; n < R; n += 2 * p2)
+        {
+            size_t j = (n - L) / 2;
+            bits[j >> 6] &= ~(1ULL << (j & 63));
+        }
+    }
+
+    // ekstraksi bit yang tersisa
+    for (size_t w = 0; w < bits.size(); w++)
+    {
+        for (uint64_t b = bits[w]; b; b &= b - 1)
+        {
+            size_t n = L + 2 * ((w << 6) + __builtin_ctzll(b)) + 1;
+            if (n < R)
+                out.push_back(n);
+        }
+    }
+}
+
+auto algorithm(size_t N)
+{
+    std::vector<size_t> primes;
+
+    for (size_t p : {2, 3, 5})
+        if (p <= N)
+            primes.push_back(p);
+
+    if (N < 7)
+        return primes;
+
+    auto small = sieve(sqrt((double) N) + 1);
+
+    // setiap segmen menyimpan hasilnya sendiri lalu digabung secara berurutan
+    size_t nsegments = N / ATKIN_SEGMENT + 1;
+    std::vector<std::vector<size_t>> found(nsegments);
+    std::atomic<size_t> next(0);
+
+    size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < nthreads; t++)
+    {
+        workers.emplace_back([&] {
+            size_t s;
+            while ((s = next++) < nsegments)
+            {
+                size_t L = s * ATKIN_SEGMENT;
+                size_t R = std::min(N + 1, L + ATKIN_SEGMENT);
+                atkin_segment(L, R, small, found[s]);
+            }
+        });
+    }
+
+    for (auto & w : workers)
+        w.join();
+
+    for (auto & f : found)
+    {
+        for (size_t p : f)
+            if (p > 5)
+                primes.push_back(p);
+    }
+
     return primes;
 }
\ No newline at end of file
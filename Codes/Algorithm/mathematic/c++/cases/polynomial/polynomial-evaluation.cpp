@@ -0,0 +1,699 @@
+/*
+    Polynomial Evaluation
+    Archive of Reversing.ID
+    Algorithm (Mathematics/Polynomial)
+
+Compile:
+    [clang]
+    $ clang++ -std=c++14 -O3 -mavx2 -mfma -pthread polynomial-evaluation.cpp -o polynomial-evaluation
+
+    [gcc]
+    $ g++ -std=c++14 -O3 -mavx2 -mfma -pthread polynomial-evaluation.cpp -o polynomial-evaluation
+
+    [msvc]
+    $ cl /std:c++14 /O2 /arch:AVX2 polynomial-evaluation.cpp
+
+Run:
+    $ polynomial-evaluation
+*/
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+/*
+    Evaluasi polinom p(x) = c[0] + c[1] x + c[2] x^2 + ... + c[n-1] x^(n-1).
+
+    Versi brute-force (lihat brute-force/c++/cases/polynom-value.cpp) menghitung pangkat
+    x secara terpisah: 2n perkalian per titik.
+
+    - Horner    p(x) = c[0] + x (c[1] + x (c[2] + ...)), n - 1 perkalian dan penjumlahan.
+                Setiap langkah bergantung pada langkah sebelumnya sehingga untuk satu titik
+                kecepatan dibatasi latency FMA (4 cycle), bukan throughput.
+    - Estrin    koefisien dipasangkan dan digabung seperti pohon:
+                    (c0 + c1 x) + (c2 + c3 x) x^2 + ((c4 + c5 x) + (c6 + c7 x) x^2) x^4
+                Operasi pada tingkat yang sama saling bebas sehingga CPU dapat
+                mengerjakannya bersamaan. Dipakai per blok 8 koefisien, antar blok
+                digabung dengan Horner dalam x^8.
+    - Batch     banyak titik sekaligus. Horner per titik, beberapa titik diproses
+                bersamaan sehingga rantai dependensi saling bebas; dengan AVX2 satu FMA
+                memproses 4 double / 8 float.
+    - Modular   semua fungsi di atas berupa template sehingga langsung berlaku untuk
+                modint_t<M>. Untuk modulus runtime dipakai Montgomery form.
+    - Multipoint untuk derajat n dan m titik yang sama-sama besar, Horner membutuhkan
+                O(nm). Dengan product tree (x - x_i) dan remainder tree kompleksitasnya
+                menjadi O((n + m) log^2 m) menggunakan perkalian NTT.
+*/
+
+// ======================================================================================
+
+/** Horner **/
+
+template <typename T>
+T horner(const T coeff[], size_t size, T x)
+{
+    T val = T();
+
+    for (size_t i = size; i > 0; i--)
+        val = val * x + coeff[i - 1];
+
+    return val;
+}
+
+// ======================================================================================
+
+/** Estrin **/
+
+// c[0] + c[1] x + ... + c[7] x^7, dengan x2 = x^2 dan x4 = x^4
+template <typename T>
+static inline
+T estrin8(const T c[], T x, T x2, T x4)
+{
+    T a = c[0] + c[1] * x;
+    T b = c[2] + c[3] * x;
+    T d = c[4] + c[5] * x;
+    T e = c[6] + c[7] * x;
+
+    return (a + b * x2) + (d + e * x2) * x4;
+}
+
+template <typename T>
+T estrin(const T coeff[], size_t size, T x)
+{
+    size_t blocks = size / 8;
+
+    // sisa koefisien teratas (< 8) tidak membentuk blok penuh
+    T val = horner(coeff + blocks * 8, size - blocks * 8, x);
+
+    T x2 = x * x, x4 = x2 * x2, x8 = x4 * x4;
+
+    for (size_t j = blocks; j > 0; j--)
+        val = val * x8 + estrin8(coeff + (j - 1) * 8, x, x2, x4);
+
+    return val;
+}
+
+// ======================================================================================
+
+/** Batch **/
+
+/*
+    out[i] = p(xs[i]) untuk i di [0, N).
+
+    Versi generik memproses LANES titik bersamaan dengan array kecil di stack; compiler
+    dapat mengubah loop dalam menjadi instruksi SIMD. Dengan AVX2 + FMA, double dan
+    float memakai BLOCK register akumulator agar latency FMA tertutup:
+    BLOCK * 4 (double) / BLOCK * 8 (float) titik per iterasi.
+*/
+
+template <typename T>
+void evaluate_serial(const T coeff[], size_t size, const T xs[], T out[], size_t N)
+{
+    const size_t LANES = 8;
+    size_t i = 0;
+
+    for (; i + LANES <= N; i += LANES)
+    {
+        T acc[LANES], x[LANES];
+
+        for (size_t l = 0; l < LANES; l++)
+        {
+            acc[l] = T();
+            x[l]   = xs[i + l];
+        }
+
+        for (size_t j = size; j > 0; j--)
+            for (size_t l = 0; l < LANES; l++)
+                acc[l] = acc[l] * x[l] + coeff[j - 1];
+
+        for (size_t l = 0; l < LANES; l++)
+            out[i + l] = acc[l];
+    }
+
+    for (; i < N; i++)
+        out[i] = horner(coeff, size, xs[i]);
+}
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+struct simd_double_t
+{
+    typedef __m256d reg;
+    static const size_t LANES = 4;
+
+    static reg  load(const double * p)          { return _mm256_loadu_pd(p); }
+    static void store(double * p, reg v)        { _mm256_storeu_pd(p, v); }
+    static reg  set1(double v)                  { return _mm256_set1_pd(v); }
+    static reg  zero()                          { return _mm256_setzero_pd(); }
+    static reg  fmadd(reg a, reg b, reg c)      { return _mm256_fmadd_pd(a, b, c); }
+};
+
+struct simd_float_t
+{
+    typedef __m256 reg;
+    static const size_t LANES = 8;
+
+    static reg  load(const float * p)           { return _mm256_loadu_ps(p); }
+    static void store(float * p, reg v)         { _mm256_storeu_ps(p, v); }
+    static reg  set1(float v)                   { return _mm256_set1_ps(v); }
+    static reg  zero()                          { return _mm256_setzero_ps(); }
+    static reg  fmadd(reg a, reg b, reg c)      { return _mm256_fmadd_ps(a, b, c); }
+};
+
+template <typename S, typename T>
+void evaluate_simd(const T coeff[], size_t size, const T xs[], T out[], size_t N)
+{
+    // latency FMA 4 cycle x 2 unit: minimal 8 akumulator independen
+    const size_t BLOCK = 8;
+    const size_t STEP  = BLOCK * S::LANES;
+
+    typename S::reg x[BLOCK], acc[BLOCK];
+    size_t i = 0;
+
+    for (; i + STEP <= N; i += STEP)
+    {
+        for (size_t b = 0; b < BLOCK; b++)
+        {
+            x[b]   = S::load(xs + i + b * S::LANES);
+            acc[b] = S::zero();
+        }
+
+        for (size_t j = size; j > 0; j--)
+        {
+            typename S::reg c = S::set1(coeff[j - 1]);
+            for (size_t b = 0; b < BLOCK; b++)
+                acc[b] = S::fmadd(acc[b], x[b], c);
+        }
+
+        for (size_t b = 0; b < BLOCK; b++)
+            S::store(out + i + b * S::LANES, acc[b]);
+    }
+
+    for (; i + S::LANES <= N; i += S::LANES)
+    {
+        typename S::reg v = S::load(xs + i), a = S::zero();
+
+        for (size_t j = size; j > 0; j--)
+            a = S::fmadd(a, v, S::set1(coeff[j - 1]));
+
+        S::store(out + i, a);
+    }
+
+    for (; i < N; i++)
+        out[i] = horner(coeff, size, xs[i]);
+}
+
+void evaluate_serial(const double coeff[], size_t size, const double xs[], double out[], size_t N)
+{
+    evaluate_simd<simd_double_t>(coeff, size, xs, out, N);
+}
+
+void evaluate_serial(const float coeff[], size_t size, const float xs[], float out[], size_t N)
+{
+    evaluate_simd<simd_float_t>(coeff, size, xs, out, N);
+}
+
+#endif
+
+// titik dibagi ke beberapa thread bila pekerjaan cukup besar
+template <typename T>
+void evaluate(const T coeff[], size_t size, const T xs[], T out[], size_t N, bool parallel = true)
+{
+    size_t nthreads = parallel ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+    nthreads = std::max<size_t>(1, std::min(nthreads, N / 1024));
+
+    if (nthreads == 1 || (double) N * size < 1e6)
+    {
+        evaluate_serial(coeff, size, xs, out, N);
+        return;
+    }
+
+    // potongan kelipatan 64 titik agar blok SIMD tidak terpotong di tengah
+    size_t chunk = ((N + nthreads - 1) / nthreads + 63) & ~size_t(63);
+    std::vector<std::thread> workers;
+
+    for (size_t lo = 0; lo < N; lo += chunk)
+    {
+        size_t count = std::min(chunk, N - lo);
+        workers.emplace_back([=] {
+            evaluate_serial(coeff, size, xs + lo, out + lo, count);
+        });
+    }
+
+    for (auto & w : workers)
+        w.join();
+}
+
+// ======================================================================================
+
+/** Runtime Modulus **/
+
+/*
+    Horner dalam Montgomery form: koefisien dan titik dikonversi sekali, lalu setiap
+    langkah hanya berupa satu perkalian Montgomery dan satu penjumlahan modular.
+    Empat titik diproses bersamaan untuk menutup latency perkalian 128-bit.
+    Modulus genap (Montgomery tidak berlaku) memakai perkalian 128-bit dengan %.
+*/
+
+/*
+    montgomery_t beserta operasinya, sama seperti bagian Modular Arithmetic
+    (mathematic/c++/cases/numbers/modular-arithmetic.cpp)
+*/
+struct montgomery_t
+{
+    uint64_t mod;
+    uint64_t inv;       // m^-1 mod 2^64
+    uint64_t r2;        // 2^128 mod m
+
+    montgomery_t(uint64_t m) : mod(m)
+    {
+        // Newton iteration: setiap langkah menggandakan bit yang benar
+        inv = m;
+        for (int i = 0; i < 5; i++)
+            inv *= 2 - m * inv;
+
+        uint64_t r = (0 - m) % m;       // 2^64 mod m
+        r2 = (unsigned __int128) r * r % m;
+    }
+
+    uint64_t reduce(unsigned __int128 t) const
+    {
+        uint64_t q  = (uint64_t) t * inv;
+        uint64_t hi = (uint64_t) (t >> 64);
+        uint64_t qm = (uint64_t) (((unsigned __int128) q * mod) >> 64);
+
+        return (hi >= qm) ? hi - qm : hi - qm + mod;
+    }
+
+    uint64_t to_mont(uint64_t x) const      { return reduce((unsigned __int128) x * r2); }
+    uint64_t from_mont(uint64_t x) const    { return reduce(x); }
+
+    // a dan b dalam Montgomery form
+    uint64_t mul(uint64_t a, uint64_t b) const
+    {
+        return reduce((unsigned __int128) a * b);
+    }
+
+    // base dan hasil dalam bentuk biasa
+    uint64_t pow(uint64_t base, uint64_t exp) const
+    {
+        uint64_t result = to_mont(1);
+
+        base = to_mont(base % mod);
+        while (exp > 0)
+        {
+            if (exp & 1)
+                result = mul(result, base);
+
+            exp  >>= 1;
+            base = mul(base, base);
+        }
+
+        return from_mont(result);
+    }
+};
+
+void evaluate_mod(const uint64_t coeff[], size_t size, const uint64_t xs[], uint64_t out[],
+    size_t N, uint64_t mod)
+{
+    if (mod == 1 || size == 0)
+    {
+        std::fill(out, out + N, 0);
+        return;
+    }
+
+    if (! (mod & 1) || mod >= (1ULL << 63))
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            uint64_t x = xs[i] % mod, val = 0;
+            for (size_t j = size; j > 0; j--)
+                val = ((unsigned __int128) val * x + coeff[j - 1] % mod) % mod;
+            out[i] = val;
+        }
+        return;
+    }
+
+    montgomery_t mt(mod);
+    std::vector<uint64_t> c(size);
+
+    for (size_t j = 0; j < size; j++)
+        c[j] = mt.to_mont(coeff[j] % mod);
+
+    auto add = [mod](uint64_t a, uint64_t b) {
+        uint64_t s = a + b;
+        return (s >= mod) ? s - mod : s;
+    };
+
+    size_t i = 0;
+    for (; i + 4 <= N; i += 4)
+    {
+        uint64_t x0 = mt.to_mont(xs[i + 0] % mod), a0 = 0;
+        uint64_t x1 = mt.to_mont(xs[i + 1] % mod), a1 = 0;
+        uint64_t x2 = mt.to_mont(xs[i + 2] % mod), a2 = 0;
+        uint64_t x3 = mt.to_mont(xs[i + 3] % mod), a3 = 0;
+
+        for (size_t j = size; j > 0; j--)
+        {
+            a0 = add(mt.mul(a0, x0), c[j - 1]);
+            a1 = add(mt.mul(a1, x1), c[j - 1]);
+            a2 = add(mt.mul(a2, x2), c[j - 1]);
+            a3 = add(mt.mul(a3, x3), c[j - 1]);
+        }
+
+        out[i + 0] = mt.from_mont(a0);
+        out[i + 1] = mt.from_mont(a1);
+        out[i + 2] = mt.from_mont(a2);
+        out[i + 3] = mt.from_mont(a3);
+    }
+
+    for (; i < N; i++)
+    {
+        uint64_t x = mt.to_mont(xs[i] % mod), a = 0;
+        for (size_t j = size; j > 0; j--)
+            a = add(mt.mul(a, x), c[j - 1]);
+        out[i] = mt.from_mont(a);
+    }
+}
+
+// ======================================================================================
+
+/** Multipoint Evaluation -- Product Tree **/
+
+/*
+    p(x_i) = p mod (x - x_i). Untuk sekumpulan titik S dengan P_S(x) = prod (x - x_i),
+    p mod (x - x_i) = (p mod P_S) mod (x - x_i) untuk setiap x_i di S.
+
+    1. Product tree: daun (x - x_i), setiap node = perkalian kedua anak.
+    2. Remainder tree: dari akar, r_node = r_parent mod P_node, turun hingga daun.
+
+    Sisa pembagian a mod b (b monic berderajat d) dihitung dengan invers power series:
+        rev(q) = rev(a) * rev(b)^-1  mod x^(deg a - d + 1)
+        r      = a - q * b
+    Invers power series dengan iterasi Newton g <- g (2 - f g), presisi berlipat dua.
+
+    Node dengan sedikit titik (<= LEAF) dievaluasi langsung dengan Horner karena pada
+    ukuran kecil perkalian NTT lebih lambat dari O(n^2). Bila titik jauh lebih banyak
+    dari derajat, titik dibagi menjadi kelompok berukuran ~derajat agar tree tidak lebih
+    besar dari yang dibutuhkan.
+
+    Hanya untuk modulus NTT (998244353).
+*/
+
+/*
+    modint_t, mint, dan perkalian polinom dengan NTT, sama seperti bagian Modular
+    Arithmetic (mathematic/c++/cases/numbers/modular-arithmetic.cpp)
+*/
+template <uint32_t M>
+struct modint_t
+{
+    uint32_t v;
+
+    constexpr modint_t(uint64_t x = 0) : v(x % M) {}
+
+    // bentuk dari nilai yang dipastikan sudah < M
+    static constexpr modint_t raw(uint32_t x)
+    {
+        modint_t r;
+        r.v = x;
+        return r;
+    }
+
+    constexpr modint_t operator+(modint_t b) const
+    {
+        uint32_t s = v + b.v;
+        return raw(s >= M ? s - M : s);
+    }
+
+    constexpr modint_t operator-(modint_t b) const
+    {
+        return raw(v >= b.v ? v - b.v : v + M - b.v);
+    }
+
+    constexpr modint_t operator*(modint_t b) const
+    {
+        return raw((uint64_t) v * b.v % M);
+    }
+
+    constexpr modint_t & operator+=(modint_t b) { return *this = *this + b; }
+    constexpr modint_t & operator-=(modint_t b) { return *this = *this - b; }
+    constexpr modint_t & operator*=(modint_t b) { return *this = *this * b; }
+
+    constexpr bool operator==(modint_t b) const { return v == b.v; }
+
+    // perpangkatan dengan binary exponentiation
+    constexpr modint_t pow(uint64_t exp) const
+    {
+        modint_t result(1), base = *this;
+
+        while (exp > 0)
+        {
+            if (exp & 1)
+                result *= base;
+
+            exp  >>= 1;
+            base *= base;
+        }
+
+        return result;
+    }
+
+    // invers dengan Fermat's little theorem, hanya berlaku bila M prima
+    constexpr modint_t inv() const
+    {
+        return pow(M - 2);
+    }
+};
+
+const uint32_t NTT_MOD  = 998244353;
+const uint32_t NTT_ROOT = 3;
+
+using mint = modint_t<NTT_MOD>;
+
+void ntt(std::vector<mint> & a, bool invert)
+{
+    size_t n = a.size();
+
+    // permutasi bit-reversal
+    for (size_t i = 1, j = 0; i < n; i++)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+            std::swap(a[i], a[j]);
+    }
+
+    // butterfly dengan panjang 2, 4, 8, ..., n
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        mint w = mint(NTT_ROOT).pow((NTT_MOD - 1) / len);
+        if (invert)
+            w = w.inv();
+
+        for (size_t i = 0; i < n; i += len)
+        {
+            mint wn(1);
+            for (size_t j = 0; j < len / 2; j++)
+            {
+                mint u = a[i + j];
+                mint v = a[i + j + len / 2] * wn;
+
+                a[i + j]           = u + v;
+                a[i + j + len / 2] = u - v;
+                wn *= w;
+            }
+        }
+    }
+
+    if (invert)
+    {
+        mint n_inv = mint(n).inv();
+        for (auto & x : a)
+            x *= n_inv;
+    }
+}
+
+// perkalian polinom: koefisien hasil modulo NTT_MOD
+std::vector<mint> multiply(std::vector<mint> a, std::vector<mint> b)
+{
+    if (a.empty() || b.empty())
+        return {};
+
+    size_t size = a.size() + b.size() - 1;
+    size_t n    = 1;
+    while (n < size)
+        n <<= 1;
+
+    a.resize(n);
+    b.resize(n);
+    ntt(a, false);
+    ntt(b, false);
+
+    for (size_t i = 0; i < n; i++)
+        a[i] *= b[i];
+
+    ntt(a, true);
+    a.resize(size);
+
+    return a;
+}
+
+typedef std::vector<mint> poly_t;
+
+// f^-1 mod x^n, syarat f[0] != 0
+poly_t inverse_series(const poly_t & f, size_t n)
+{
+    poly_t g(1, f[0].inv());
+
+    for (size_t len = 1; len < n; len <<= 1)
+    {
+        poly_t head(f.begin(), f.begin() + std::min(f.size(), 2 * len));
+        poly_t fg = multiply(head, g);
+
+        fg.resize(2 * len);
+        for (auto & v : fg)
+            v = mint() - v;
+        fg[0] += mint(2);
+
+        g = multiply(g, fg);
+        g.resize(2 * len);
+    }
+
+    g.resize(n);
+    return g;
+}
+
+// a mod b, b monic
+poly_t remainder(const poly_t & a, const poly_t & b)
+{
+    size_t d = b.size() - 1;
+
+    if (a.size() <= d)
+        return a;
+
+    size_t k = a.size() - d;
+
+    poly_t ra(a.rbegin(), a.rbegin() + k);
+    poly_t rb(b.rbegin(), b.rend());
+
+    poly_t q = multiply(ra, inverse_series(rb, k));
+    q.resize(k);
+    std::reverse(q.begin(), q.end());
+
+    poly_t qb = multiply(q, b);
+    poly_t r(d);
+
+    for (size_t i = 0; i < d; i++)
+        r[i] = a[i] - qb[i];
+
+    return r;
+}
+
+struct product_tree_t
+{
+    static const size_t LEAF = 64;
+
+    const mint * xs;
+    std::vector<poly_t> node;           // node[1] akar, anak node[2v] dan node[2v + 1]
+
+    product_tree_t(const mint xs_[], size_t N) : xs(xs_), node(4 * ((N + LEAF - 1) / LEAF + 1))
+    {
+        build(1, 0, N);
+    }
+
+    void build(size_t v, size_t lo, size_t hi)
+    {
+        if (hi - lo <= LEAF)
+        {
+            // prod (x - x_i) secara langsung, O(LEAF^2)
+            poly_t & p = node[v];
+            p.assign(1, mint(1));
+
+            for (size_t i = lo; i < hi; i++)
+            {
+                p.push_back(mint());
+                for (size_t j = p.size() - 1; j > 0; j--)
+                    p[j] = p[j - 1] - p[j] * xs[i];
+                p[0] = mint() - p[0] * xs[i];
+            }
+            return;
+        }
+
+        size_t mid = lo + (hi - lo) / 2;
+
+        build(2 * v, lo, mid);
+        build(2 * v + 1, mid, hi);
+        node[v] = multiply(node[2 * v], node[2 * v + 1]);
+    }
+
+    void descend(size_t v, size_t lo, size_t hi, const poly_t & p, mint out[]) const
+    {
+        poly_t r = remainder(p, node[v]);
+
+        if (hi - lo <= LEAF)
+        {
+            for (size_t i = lo; i < hi; i++)
+                out[i] = horner(r.data(), r.size(), xs[i]);
+            return;
+        }
+
+        size_t mid = lo + (hi - lo) / 2;
+
+        descend(2 * v, lo, mid, r, out);
+        descend(2 * v + 1, mid, hi, r, out);
+    }
+};
+
+// out[i] = p(xs[i])
+void multipoint(const poly_t & p, const mint xs[], mint out[], size_t N)
+{
+    // kelompok titik ~ derajat polinom, minimal satu daun
+    size_t group = std::max(product_tree_t::LEAF, p.size());
+
+    for (size_t lo = 0; lo < N; lo += group)
+    {
+        size_t count = std::min(group, N - lo);
+        product_tree_t tree(xs + lo, count);
+        tree.descend(1, 0, count, p, out + lo);
+    }
+}
+
+// ======================================================================================
+
+template <typename T>
+T algorithm(const T coeff[], size_t size, T x)
+{
+    return estrin(coeff, size, x);
+}
+
+template <typename T>
+void algorithm(const T coeff[], size_t size, const T xs[], T out[], size_t N)
+{
+    evaluate(coeff, size, xs, out, N);
+}
+
+/*
+    Batch Horner O(nm) untuk ukuran kecil, product tree bila derajat dan jumlah titik
+    sama-sama besar. Titik potong (n = m ~ 2^14) diukur pada satu core; di bawahnya
+    konstanta NTT lebih besar dari keuntungan kompleksitas.
+*/
+std::vector<mint> algorithm(const poly_t & p, const std::vector<mint> & xs)
+{
+    std::vector<mint> out(xs.size());
+
+    if (p.size() < 16384 || xs.size() < 16384)
+        evaluate(p.data(), p.size(), xs.data(), out.data(), xs.size());
+    else
+        multipoint(p, xs.data(), out.data(), xs.size());
+
+    return out;
+}
\ No newline at end of file